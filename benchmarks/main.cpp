@@ -0,0 +1,458 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <new>
+#include <string>
+#include <bitcoin/system.hpp>
+
+BC_USE_LIBBITCOIN_MAIN
+
+// Validation pipeline benchmarks.
+// ----------------------------------------------------------------------------
+// usage: libbitcoin-system-benchmarks <iterations> <corpus directory>
+//
+// The corpus is a directory of <height>.block files, each a raw (witness)
+// serialized block. Prevouts not internal to a block may be provided in an
+// optional <height>.prevouts file, as serialized outputs concatenated in the
+// order of the block's inputs that are not populated internally. A corpus
+// without any readable block is an error. Inputs without prevouts are not
+// connected, and validation failures are counted (not fatal). Interpreter
+// figures are reported per spend pattern and per opcode (op_trace).
+// ----------------------------------------------------------------------------
+
+using namespace bc;
+using namespace bc::system;
+using namespace bc::system::chain;
+using clock_type = std::chrono::steady_clock;
+
+BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+BC_PUSH_WARNING(NO_MALLOC_OR_FREE)
+
+// Heap allocation counting (std allocator and shared_ptr control blocks).
+// ----------------------------------------------------------------------------
+
+static std::atomic<size_t> heap_allocations{};
+
+void* operator new(size_t size)
+{
+    ++heap_allocations;
+    if (const auto ptr = std::malloc(std::max(size, one)))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+// Arena allocation counting (libbitcoin allocator, used in deserialization).
+// ----------------------------------------------------------------------------
+
+class counting_arena final
+  : public arena
+{
+public:
+    void* start(size_t) THROWS override
+    {
+        return nullptr;
+    }
+
+    size_t detach() NOEXCEPT override
+    {
+        return zero;
+    }
+
+    void release(void*) NOEXCEPT override
+    {
+    }
+
+    std::atomic<size_t> allocations{};
+
+private:
+    void* do_allocate(size_t bytes, size_t align) THROWS override
+    {
+        ++allocations;
+        return default_arena::get()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override
+    {
+        default_arena::get()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const arena& other) const NOEXCEPT override
+    {
+        return &other == this;
+    }
+};
+
+static counting_arena arena_allocations{};
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+// Stage measurement.
+// ----------------------------------------------------------------------------
+
+struct stage
+{
+    std::string name{};
+    std::chrono::nanoseconds time{};
+    size_t bytes{};
+    size_t items{};
+    size_t failures{};
+    size_t heap{};
+    size_t arena{};
+};
+
+template <typename Function>
+static void measure(stage& out, size_t bytes, Function&& function)
+{
+    const auto heap = heap_allocations.load();
+    const auto arena = arena_allocations.allocations.load();
+    const auto start = clock_type::now();
+    const auto success = function();
+    out.time += clock_type::now() - start;
+    out.heap += heap_allocations.load() - heap;
+    out.arena += arena_allocations.allocations.load() - arena;
+    out.bytes += bytes;
+    out.items += one;
+    out.failures += success ? zero : one;
+}
+
+static void report(const stage& value)
+{
+    const auto ns = static_cast<double>(value.time.count());
+    const auto seconds = ns / 1'000'000'000.0;
+    const auto items = static_cast<double>(std::max(value.items, one));
+    const auto mbps = is_zero(ns) ? 0.0 :
+        static_cast<double>(value.bytes) / (1024.0 * 1024.0) / seconds;
+
+    system::cout
+        << std::left << std::setw(24) << value.name << std::right
+        << std::fixed << std::setprecision(1)
+        << std::setw(12) << ns / items << " ns/item"
+        << std::setw(10) << mbps << " MiB/s"
+        << std::setw(10) << value.heap / items << " heap/item"
+        << std::setw(10) << value.arena / items << " arena/item"
+        << std::setw(8) << value.items << " items"
+        << std::setw(6) << value.failures << " failed"
+        << std::endl;
+}
+
+// Corpus.
+// ----------------------------------------------------------------------------
+
+struct entry
+{
+    size_t height{};
+    data_chunk data{};
+    data_chunk prevouts{};
+};
+
+static data_chunk read_file(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file), {} };
+}
+
+static std::vector<entry> load_corpus(const std::filesystem::path& directory)
+{
+    std::vector<entry> corpus{};
+    std::error_code ec{};
+    for (const auto& file: std::filesystem::directory_iterator(directory, ec))
+    {
+        const auto& path = file.path();
+        if (path.extension() != ".block")
+            continue;
+
+        size_t height{};
+        deserialize(height, path.stem().string());
+        auto prevouts = path;
+        prevouts.replace_extension(".prevouts");
+        corpus.push_back({ height, read_file(path), read_file(prevouts) });
+    }
+
+    std::sort(corpus.begin(), corpus.end(), [](const auto& left,
+        const auto& right) { return left.height < right.height; });
+
+    return corpus;
+}
+
+// Assign internal prevouts, then external prevouts in input order.
+static void populate(const block& instance, const context& ctx,
+    const data_chunk& prevouts)
+{
+    instance.populate(ctx);
+    stream::in::fast stream(prevouts);
+    read::bytes::fast source(stream);
+
+    const auto& txs = *instance.transactions_ptr();
+    for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+        for (const auto& in: *(*tx)->inputs_ptr())
+            if (!in->prevout && !source.is_exhausted())
+                in->prevout = to_shared<output>(source);
+}
+
+static context to_context(const block& instance, size_t height)
+{
+    const auto& header = instance.header();
+    return
+    {
+        flags::all_rules,
+        header.timestamp(),
+        zero,
+        height,
+        zero,
+        header.bits()
+    };
+}
+
+static const char* pattern_name(script_pattern pattern)
+{
+    switch (pattern)
+    {
+        case script_pattern::pay_null_data: return "pay_null_data";
+        case script_pattern::pay_multisig: return "pay_multisig";
+        case script_pattern::pay_public_key: return "pay_public_key";
+        case script_pattern::pay_key_hash: return "pay_key_hash";
+        case script_pattern::pay_script_hash: return "pay_script_hash";
+        case script_pattern::pay_witness_key_hash: return "pay_witness_key_hash";
+        case script_pattern::pay_witness_script_hash: return "pay_witness_script_hash";
+        case script_pattern::pay_witness_v1_taproot: return "pay_witness_v1_taproot";
+        default: return "non_standard";
+    }
+}
+
+// Interpreter trace (per input connect above).
+// ----------------------------------------------------------------------------
+
+static std::string opcode_name(opcode code)
+{
+    return operation::is_payload(code) ?
+        "push_" + encode_base16(data_chunk{ static_cast<uint8_t>(code) }) :
+        operation{ code }.to_string(flags::all_rules);
+}
+
+static const char* spend_name(machine::spend_pattern pattern)
+{
+    switch (pattern)
+    {
+        case machine::spend_pattern::p2pkh: return "p2pkh";
+        case machine::spend_pattern::p2sh: return "p2sh";
+        case machine::spend_pattern::p2wpkh: return "p2wpkh";
+        case machine::spend_pattern::p2wsh: return "p2wsh";
+        case machine::spend_pattern::p2tr_keypath: return "p2tr_keypath";
+        case machine::spend_pattern::p2tr_scriptpath: return "p2tr_scriptpath";
+        default: return "other";
+    }
+}
+
+static void report(const std::string& name,
+    const machine::op_trace::counter& value)
+{
+    if (is_zero(value.executions))
+        return;
+
+    const auto ns = static_cast<double>(value.nanoseconds);
+    const auto executions = static_cast<double>(value.executions);
+
+    system::cout
+        << std::left << std::setw(24) << name << std::right
+        << std::fixed << std::setprecision(1)
+        << std::setw(12) << ns / executions << " ns/exec"
+        << std::setw(12) << value.executions << " execs"
+        << std::setw(8) << value.depth << " depth"
+        << std::endl;
+}
+
+// Pipeline.
+// ----------------------------------------------------------------------------
+
+int bc::system::main(int argc, char* argv[])
+{
+    set_utf8_stdio();
+
+    size_t iterations{};
+    if (argc != 3 || !deserialize(iterations, argv[1]) || is_zero(iterations))
+    {
+        system::cerr << "usage: " << argv[0]
+            << " <iterations> <corpus directory>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto corpus = load_corpus(argv[2]);
+    if (corpus.empty())
+    {
+        system::cerr << "error: no <height>.block files in corpus directory "
+            << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const settings mainnet(selection::mainnet);
+
+    std::map<std::string, stage> patterns{};
+    stage block_deserialize{ "block.deserialize" };
+    stage block_check{ "block.check" };
+    stage block_accept{ "block.accept" };
+    stage block_connect{ "block.connect" };
+    stage block_to_data{ "block.to_data" };
+    stage tx_deserialize{ "transaction.deserialize" };
+    stage tx_check{ "transaction.check" };
+    stage tx_accept{ "transaction.accept" };
+    stage tx_connect{ "transaction.connect" };
+    stage tx_to_data{ "transaction.to_data" };
+
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        for (const auto& item: corpus)
+        {
+            const auto size = item.data.size();
+            block::cptr instance{};
+            measure(block_deserialize, size, [&]()
+            {
+                instance = block::from_arena(arena_allocations, item.data,
+                    true);
+                return instance->is_valid();
+            });
+
+            if (!instance->is_valid())
+                continue;
+
+            const auto ctx = to_context(*instance, item.height);
+            populate(*instance, ctx, item.prevouts);
+
+            measure(block_check, size, [&]()
+            {
+                return !instance->check() && !instance->check(ctx);
+            });
+
+            measure(block_accept, size, [&]()
+            {
+                return !instance->accept(ctx,
+                    mainnet.subsidy_interval_blocks,
+                    mainnet.initial_subsidy());
+            });
+
+            measure(block_connect, size, [&]()
+            {
+                return !instance->connect(ctx);
+            });
+
+            measure(block_to_data, size, [&]()
+            {
+                return instance->to_data(true).size() == size;
+            });
+
+            for (const auto& tx: *instance->transactions_ptr())
+            {
+                const auto data = tx->to_data(true);
+                const auto bytes = data.size();
+
+                measure(tx_deserialize, bytes, [&]()
+                {
+                    stream::in::fast stream(data);
+                    read::bytes::fast source(stream, &arena_allocations);
+                    return transaction{ source, true }.is_valid();
+                });
+
+                measure(tx_check, bytes, [&]()
+                {
+                    return !tx->check() && !tx->check(ctx);
+                });
+
+                if (tx->is_coinbase())
+                    continue;
+
+                measure(tx_accept, bytes, [&]()
+                {
+                    return !tx->accept(ctx);
+                });
+
+                measure(tx_connect, bytes, [&]()
+                {
+                    return !tx->connect(ctx);
+                });
+
+                measure(tx_to_data, bytes, [&]()
+                {
+                    return tx->to_data(true).size() == bytes;
+                });
+
+                // Interpreter time by prevout script pattern.
+                const auto& ins = *tx->inputs_ptr();
+                for (auto in = ins.begin(); in != ins.end(); ++in)
+                {
+                    if (!(*in)->prevout)
+                        continue;
+
+                    const auto name = pattern_name(
+                        (*in)->prevout->script().output_pattern());
+                    auto& pattern = patterns[name];
+                    pattern.name = std::string{ "connect." } + name;
+                    measure(pattern, (*in)->serialized_size(true), [&]()
+                    {
+                        using namespace machine;
+                        return !interpreter<flat_stack, op_trace>::connect(
+                            ctx, *tx, in);
+                    });
+                }
+            }
+        }
+    }
+
+    for (const auto& value:
+    {
+        block_deserialize, block_check, block_accept, block_connect,
+        block_to_data, tx_deserialize, tx_check, tx_accept, tx_connect,
+        tx_to_data
+    })
+        report(value);
+
+    for (const auto& pattern: patterns)
+        report(pattern.second);
+
+    using namespace machine;
+    const auto spends = op_trace::spends();
+    for (size_t index = 0; index < spends.size(); ++index)
+        report(std::string{ "trace." } + spend_name(
+            static_cast<spend_pattern>(index)), spends.at(index));
+
+    const auto opcodes = op_trace::opcodes();
+    for (size_t index = 0; index < opcodes.size(); ++index)
+        report(std::string{ "trace." } + opcode_name(
+            static_cast<opcode>(index)), opcodes.at(index));
+
+    return EXIT_SUCCESS;
+}
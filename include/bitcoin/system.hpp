@@ -34,11 +34,13 @@
 #include <bitcoin/system/warnings.hpp>
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_parser.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/compact.hpp>
 #include <bitcoin/system/chain/context.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/operation.hpp>
@@ -121,6 +123,7 @@
 #include <bitcoin/system/data/iterable.hpp>
 #include <bitcoin/system/data/memory.hpp>
 #include <bitcoin/system/data/no_fill_allocator.hpp>
+#include <bitcoin/system/data/shared_window.hpp>
 #include <bitcoin/system/data/string.hpp>
 #include <bitcoin/system/endian/batch.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -188,6 +191,7 @@
 #include <bitcoin/system/machine/number_integer.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/machine/stack.hpp>
+#include <bitcoin/system/machine/trace.hpp>
 #include <bitcoin/system/math/addition.hpp>
 #include <bitcoin/system/math/bits.hpp>
 #include <bitcoin/system/math/bytes.hpp>
@@ -237,6 +241,8 @@
 #include <bitcoin/system/stream/streamers/byte_flipper.hpp>
 #include <bitcoin/system/stream/streamers/byte_reader.hpp>
 #include <bitcoin/system/stream/streamers/byte_writer.hpp>
+#include <bitcoin/system/stream/streamers/fast_reader.hpp>
+#include <bitcoin/system/stream/streamers/fast_writer.hpp>
 #include <bitcoin/system/stream/streamers/hex_reader.hpp>
 #include <bitcoin/system/stream/streamers/hex_writer.hpp>
 #include <bitcoin/system/stream/streamers/sha256_writer.hpp>
@@ -19,6 +19,8 @@
 #ifndef LIBBITCOIN_SYSTEM_ARENA_HPP
 #define LIBBITCOIN_SYSTEM_ARENA_HPP
 
+#include <cstdint>
+#include <memory>
 #include <bitcoin/system/exceptions.hpp>
 
 namespace libbitcoin {
@@ -103,6 +105,123 @@ private:
     bool do_is_equal(const arena& other) const NOEXCEPT override;
 };
 
+/// Detachable linear (bump) allocator, for placement of an object graph of
+/// common lifetime (such as a deserialized block) in one memory region.
+/// start() allocates the initial buffer, which is extended by linked buffers
+/// as required. Deallocation is a nop, detach() transfers ownership of the
+/// allocation to the caller, and release(memory) frees it in one call.
+/// Allocation is NOT thread safe (use one instance per thread), however a
+/// detached allocation may be released from any thread.
+class BC_API linear_arena final
+  : public arena
+{
+public:
+    DELETE_COPY_MOVE(linear_arena);
+
+    static constexpr size_t default_minimum = 1024u * 1024u;
+
+    /// Minimum size of each buffer allocated by the arena.
+    linear_arena(size_t minimum=default_minimum) NOEXCEPT;
+    ~linear_arena() NOEXCEPT override;
+
+    void* start(size_t baseline) THROWS override;
+    size_t detach() NOEXCEPT override;
+    void release(void* address) NOEXCEPT override;
+
+private:
+    // Each buffer is prefixed by a link to the next buffer (or nullptr).
+    struct link { link* next; size_t size; };
+
+    // Buffer data follows the link, maximally aligned.
+    static constexpr size_t link_size = sizeof(link) +
+        (alignof(max_align_t) - sizeof(link) % alignof(max_align_t)) %
+            alignof(max_align_t);
+
+    void* do_allocate(size_t bytes, size_t align) THROWS override;
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override;
+    bool do_is_equal(const arena& other) const NOEXCEPT override;
+
+    static uint8_t* data(link* buffer) NOEXCEPT;
+    link* extend(size_t bytes) THROWS;
+
+    const size_t minimum_;
+    link* memory_{};
+    link* current_{};
+    size_t offset_{};
+    size_t size_{};
+};
+
+/// Fixed inline buffer linear (bump) allocator, for small object graphs of
+/// common lifetime (such as a script stack). Allocation that exceeds the
+/// buffer falls back to the default arena. Deallocation within the buffer is
+/// a nop. Not detachable and allocation is NOT thread safe.
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_ARRAY_TO_POINTER_DECAY)
+template <size_t Size>
+class inline_arena final
+  : public arena
+{
+public:
+    DELETE_COPY_MOVE(inline_arena);
+
+    inline_arena() NOEXCEPT
+    {
+    }
+    ~inline_arena() NOEXCEPT override = default;
+
+    void* start(size_t) THROWS override
+    {
+        return nullptr;
+    }
+
+    size_t detach() NOEXCEPT override
+    {
+        return offset_;
+    }
+
+    void release(void*) NOEXCEPT override
+    {
+    }
+
+private:
+    bool is_inline(const void* ptr) const NOEXCEPT
+    {
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+        const auto first = reinterpret_cast<uintptr_t>(buffer_);
+        return address >= first && address < first + Size;
+    }
+
+    void* do_allocate(size_t bytes, size_t align) THROWS override
+    {
+        void* ptr = &buffer_[offset_];
+        auto space = Size - offset_;
+        if (std::align(align, bytes, ptr, space) == nullptr)
+            return default_arena::get()->allocate(bytes, align);
+
+        offset_ = Size - space + bytes;
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override
+    {
+        if (!is_inline(ptr))
+            default_arena::get()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const arena& other) const NOEXCEPT override
+    {
+        // Do not cross the streams.
+        return &other == this;
+    }
+
+    alignas(max_align_t) uint8_t buffer_[Size];
+    size_t offset_{};
+};
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 } // namespace libbitcoin
 
 #endif
@@ -20,8 +20,10 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_HPP
 
 #include <memory>
+#include <optional>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/context.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
@@ -42,6 +44,18 @@ public:
 
     typedef std::shared_ptr<const block> cptr;
 
+    /// Sizes and counts, computed in one pass over txs upon construction.
+    /// Outputs and spends exclude the coinbase transaction.
+    struct metrics
+    {
+        size_t nominal;
+        size_t witnessed;
+        size_t weight;
+        size_t outputs;
+        size_t spends;
+        size_t segregated;
+    };
+
     static bool is_malleable64(const transaction_cptrs& txs) NOEXCEPT;
     static hashes merkle_branch(size_t position, hashes&& leaves) NOEXCEPT;
     static uint64_t subsidy(size_t height, uint64_t subsidy_interval,
@@ -61,6 +75,13 @@ public:
     block(stream::in::fast& stream, bool witness) NOEXCEPT;
     block(std::istream& stream, bool witness) NOEXCEPT;
     block(reader& source, bool witness) NOEXCEPT;
+    block(fast_reader& source, bool witness) NOEXCEPT;
+
+    /// Deserialize the full object graph into the (detachable) arena, which
+    /// must outlive the block. The block owns the detached allocation and
+    /// releases it in one call upon destruct, so no member may outlive it.
+    static cptr from_arena(arena& memory, const data_slice& data,
+        bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -74,6 +95,10 @@ public:
     data_chunk to_data(bool witness) const NOEXCEPT;
     void to_data(std::ostream& stream, bool witness) const NOEXCEPT;
     void to_data(writer& sink, bool witness) const NOEXCEPT;
+    void to_data(fast_writer& sink, bool witness) const NOEXCEPT;
+
+    /// Zero copy of retained bytes, witness form is a selection of the sink.
+    void to_data(gather& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -89,6 +114,7 @@ public:
     hashes merkle_branch(size_t position, bool witness) const NOEXCEPT;
 
     /// Computed properties.
+    const metrics& get_metrics() const NOEXCEPT;
     size_t outputs() const NOEXCEPT;
     size_t spends() const NOEXCEPT;
     size_t weight() const NOEXCEPT;
@@ -116,6 +142,10 @@ public:
     /// Cache (overrides hash() computation).
     void set_hashes(const data_chunk& data) NOEXCEPT;
 
+    /// Cache all transaction hashes, serialized and batch hashed concurrently.
+    /// Witness hashes are cached only for segregated non-coinbase txs.
+    void set_transaction_hashes(bool witness) const NOEXCEPT;
+
     /// Reference used to avoid copy, sets cache if not set.
     const hash_digest& get_hash() const NOEXCEPT;
 
@@ -127,6 +157,10 @@ public:
     void set_allocation(size_t allocation) const NOEXCEPT;
     size_t get_allocation() const NOEXCEPT;
 
+    /// Cache context free (input and output script) signature operations,
+    /// reused by signature_operations. Parses all scripts, so not implied.
+    void set_signature_operations() const NOEXCEPT;
+
     /// Identity.
     /// -----------------------------------------------------------------------
 
@@ -141,7 +175,7 @@ public:
     code check(const context& ctx) const NOEXCEPT;
     code accept(const context& ctx, size_t subsidy_interval,
         uint64_t initial_subsidy) const NOEXCEPT;
-    code connect(const context& ctx) const NOEXCEPT;
+    code connect(const context& ctx, bool concurrent=false) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
     /// Populate previous outputs internal to the block.
@@ -151,6 +185,7 @@ public:
 protected:
     block(stream::in::fast&& stream, bool witness) NOEXCEPT;
     block(reader&& source, bool witness) NOEXCEPT;
+    block(fast_reader&& source, bool witness) NOEXCEPT;
     block(const chain::header::cptr& header,
         const chain::transactions_cptr& txs, bool valid) NOEXCEPT;
 
@@ -195,13 +230,18 @@ protected:
         bool bip141) const NOEXCEPT;
 
 private:
-    typedef struct { size_t nominal; size_t witnessed; } sizes;
-
-    void assign_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool witness) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink, bool witness) const NOEXCEPT;
     static block from_data(reader& source, bool witness) NOEXCEPT;
-    static sizes serialized_size(const transaction_cptrs& txs) NOEXCEPT;
+    static metrics measure(const transaction_cptrs& txs) NOEXCEPT;
+
+    // Context free input and output script sigops (unscaled).
+    size_t legacy_signature_operations() const NOEXCEPT;
 
     // context free
+    hashes batch_transaction_hashes(bool witness) const NOEXCEPT;
     hash_digest generate_merkle_root(bool witness) const NOEXCEPT;
     bool get_witness_commitment(hash_cref& commitment) const NOEXCEPT;
     bool get_witness_reservation(hash_cref& reservation) const NOEXCEPT;
@@ -214,7 +254,8 @@ private:
     code check_transactions() const NOEXCEPT;
     code check_transactions(const context& ctx) const NOEXCEPT;
     code accept_transactions(const context& ctx) const NOEXCEPT;
-    code connect_transactions(const context& ctx) const NOEXCEPT;
+    code connect_transactions(const context& ctx,
+        bool concurrent) const NOEXCEPT;
     code confirm_transactions(const context& ctx) const NOEXCEPT;
 
     // Block should be stored as shared (adds 16 bytes).
@@ -224,8 +265,11 @@ private:
 
     // Cache.
     bool valid_;
-    sizes size_;
+    metrics metrics_;
     mutable size_t allocation_{};
+
+    // Counting parses scripts (deferred), so this is cached only when set.
+    mutable std::optional<size_t> legacy_sigops_{};
 };
 
 typedef std_vector<block> blocks;
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_PARSER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_PARSER_HPP
+
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Resumable block parser, accepts block bytes in chunks as received.
+/// Each transaction is emitted (with identity hashes cached) as soon as its
+/// last byte is pushed. Scanning of an incomplete transaction resumes where
+/// the previous push stopped, so each byte is copied and scanned once. Parsed
+/// bytes are released once they exceed the unparsed remainder. Not thread safe.
+class BC_API block_parser
+{
+public:
+    DELETE_COPY(block_parser);
+    DEFAULT_MOVE(block_parser);
+
+    block_parser(bool witness=true) NOEXCEPT;
+
+    /// Parse chunk, returning transactions completed by it (in block order).
+    /// Bytes pushed once complete (or failed) fail the parse.
+    transaction_cptrs push(const data_slice& chunk) NOEXCEPT;
+
+    /// All declared transactions parsed (and no extra bytes pushed).
+    bool is_complete() const NOEXCEPT;
+
+    /// Parse failed, position is the block offset of the failing element.
+    bool is_failed() const NOEXCEPT;
+
+    /// Block offset of failure, otherwise count of bytes parsed.
+    size_t position() const NOEXCEPT;
+
+    /// Header once parsed, otherwise nullptr.
+    const header::cptr& header_ptr() const NOEXCEPT;
+
+    /// Declared and parsed transaction counts.
+    size_t declared() const NOEXCEPT;
+    size_t parsed() const NOEXCEPT;
+
+    /// Block of header and all emitted transactions (invalid if incomplete).
+    block to_block() const NOEXCEPT;
+
+private:
+    enum class step : uint8_t
+    {
+        version,
+        input_count,
+        input_point,
+        input_script,
+        input_sequence,
+        output_count,
+        output_value,
+        output_script,
+        witness_count,
+        witness_element,
+        locktime,
+        complete
+    };
+
+    /// Partial scan of the leading transaction, retained across pushes.
+    struct progress
+    {
+        step at{ step::version };
+        bool segregated{};
+        size_t inputs{};
+        size_t outputs{};
+        size_t elements{};
+        size_t index{};
+        size_t element{};
+        size_t cursor{};
+    };
+
+    /// Serialized size of the leading transaction, zero if incomplete,
+    /// max_size_t if structurally invalid. Resumes from the retained progress.
+    size_t scan() NOEXCEPT;
+
+    bool parse_header() NOEXCEPT;
+    bool parse_count() NOEXCEPT;
+    transaction::cptr parse_transaction() NOEXCEPT;
+    void fail() NOEXCEPT;
+    size_t remaining() const NOEXCEPT;
+    const uint8_t* next() const NOEXCEPT;
+
+    bool witness_;
+    bool failed_{};
+    bool counted_{};
+    size_t declared_{};
+    size_t consumed_{};
+    size_t offset_{};
+    progress scan_{};
+    data_chunk buffer_{};
+    header::cptr header_{};
+    transactions_ptr txs_{ to_shared<transaction_cptrs>() };
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -19,11 +19,11 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_CHAIN_STATE_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_CHAIN_STATE_HPP
 
-#include <deque>
 #include <memory>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/flags.hpp>
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/forks.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -46,9 +46,13 @@ class BC_API chain_state
 public:
     DELETE_COPY_MOVE_DESTRUCT(chain_state);
 
-    typedef std::deque<uint32_t> bitss;
-    typedef std::deque<uint32_t> versions;
-    typedef std::deque<uint32_t> timestamps;
+    /// Windows are shared by derived states, so derivation does not copy them.
+    /// API change: these were std::deque<uint32_t>. Callers populating data
+    /// are limited to push_back/pop_front and const access, as elements are
+    /// not mutable in place and a window is not assignable from a deque.
+    typedef shared_window<uint32_t> bitss;
+    typedef shared_window<uint32_t> versions;
+    typedef shared_window<uint32_t> timestamps;
     typedef std::shared_ptr<const chain_state> cptr;
     typedef struct { size_t count; size_t high; } range;
 
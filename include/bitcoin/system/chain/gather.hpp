@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_GATHER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_GATHER_HPP
+
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Scatter/gather serialization sink, not thread safe.
+/// Retained bytes (such as script and witness elements) are referenced in
+/// place, other fields are encoded to an owned buffer. Witness segments are
+/// tagged, so nominal and witness forms are selections of the same segments.
+/// Referenced objects must outlive the selected slices.
+class BC_API gather
+{
+public:
+    typedef std::vector<data_slice> slices;
+
+    /// Tag subsequent writes as witness (excluded from nominal selection).
+    void set_witness(bool witness) NOEXCEPT;
+
+    /// Reference retained bytes (copied if smaller than a slice).
+    void reference(const data_slice& data) NOEXCEPT;
+
+    /// Encode bytes to the owned buffer.
+    void write_byte(uint8_t value) NOEXCEPT;
+    void write_bytes(const data_slice& data) NOEXCEPT;
+    void write_4_bytes_little_endian(uint32_t value) NOEXCEPT;
+    void write_8_bytes_little_endian(uint64_t value) NOEXCEPT;
+    void write_variable(uint64_t value) NOEXCEPT;
+
+    /// Selection of segments, with or without witness segments.
+    slices to_slices(bool witness) const NOEXCEPT;
+    size_t size(bool witness) const NOEXCEPT;
+
+    /// Contiguous copy of the selection (not zero copy).
+    data_chunk to_data(bool witness) const NOEXCEPT;
+
+private:
+    struct segment
+    {
+        /// Referenced bytes, or nullptr for owned buffer offset.
+        const uint8_t* data;
+        size_t offset;
+        size_t size;
+        bool witness;
+    };
+
+    void append(size_t size) NOEXCEPT;
+
+    data_chunk buffer_{};
+    std::vector<segment> segments_{};
+    bool witness_{};
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
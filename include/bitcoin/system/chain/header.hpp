@@ -22,6 +22,7 @@
 #include <memory>
 #include <optional>
 #include <bitcoin/system/chain/chain_state.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
@@ -67,6 +68,7 @@ public:
     header(stream::in::fast& stream) NOEXCEPT;
     header(std::istream& stream) NOEXCEPT;
     header(reader& source) NOEXCEPT;
+    header(fast_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -80,6 +82,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(fast_writer& sink) const NOEXCEPT;
+    void to_data(gather& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -122,6 +126,7 @@ public:
 protected:
     header(stream::in::fast&& stream) NOEXCEPT;
     header(reader&& source) NOEXCEPT;
+    header(fast_reader&& source) NOEXCEPT;
     header(uint32_t version, hash_digest&& previous_block_hash,
         hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
         uint32_t nonce, bool valid) NOEXCEPT;
@@ -144,7 +149,10 @@ protected:
     // error::incorrect_proof_of_work
 
 private:
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink) const NOEXCEPT;
 
     // Header should be stored as shared (adds 16 bytes).
     // copy: 4 * 32 + 2 * 256 + 1 = 81 bytes (vs. 16 when shared).
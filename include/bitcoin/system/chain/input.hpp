@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <bitcoin/system/chain/context.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/prevout.hpp>
@@ -71,6 +72,7 @@ public:
     input(stream::in::fast& stream) NOEXCEPT;
     input(std::istream& stream) NOEXCEPT;
     input(reader& source) NOEXCEPT;
+    input(fast_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -84,6 +86,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(fast_writer& sink) const NOEXCEPT;
+    void to_data(gather& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -113,6 +117,11 @@ public:
     /// Assumes coinbase if prevout not populated (returns only legacy sigops).
     size_t signature_operations(bool bip16, bool bip141) const NOEXCEPT;
 
+    /// Embedded and witness sigops only (excludes input script), zero if
+    /// prevout not populated.
+    size_t embedded_signature_operations(bool bip16,
+        bool bip141) const NOEXCEPT;
+
     /// Requires metadata.prevout_height and median_time_past (otherwise true).
     bool is_relative_locked(size_t height,
         uint32_t median_time_past) const NOEXCEPT;
@@ -120,6 +129,7 @@ public:
 protected:
     input(stream::in::fast&& stream) NOEXCEPT;
     input(reader&& source) NOEXCEPT;
+    input(fast_reader&& source) NOEXCEPT;
     input(const chain::point::cptr& point, const chain::script::cptr& script,
         const chain::witness::cptr& witness, uint32_t sequence,
         bool valid) NOEXCEPT;
@@ -138,6 +148,12 @@ private:
     size_t nominal_size() const NOEXCEPT;
     size_t witnessed_size() const NOEXCEPT;
     void set_witness(reader& source) NOEXCEPT;
+    void set_witness(fast_reader& source) NOEXCEPT;
+
+    template <typename Source>
+    void assign_witness(Source& source) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink) const NOEXCEPT;
 
     const chain::witness& get_witness() const NOEXCEPT;
     const chain::witness::cptr& get_witness_cptr() const NOEXCEPT;
@@ -109,6 +109,7 @@ public:
     operation(stream::in::fast& stream) NOEXCEPT;
     operation(std::istream& stream) NOEXCEPT;
     operation(reader& source) NOEXCEPT;
+    operation(fast_reader& source) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     // TODO: a byte-deserialized operation cannot be invalid unless empty.
@@ -129,6 +130,7 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(fast_writer& sink) const NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     std::string to_string(uint32_t active_flags) const NOEXCEPT;
@@ -148,6 +150,7 @@ public:
 protected:
     operation(stream::in::fast&& stream) NOEXCEPT;
     operation(reader&& source) NOEXCEPT;
+    operation(fast_reader&& source) NOEXCEPT;
     operation(opcode code, const chunk_cptr& push_data_ptr,
         bool underflow) NOEXCEPT;
 
@@ -155,6 +158,7 @@ private:
     // So script may call count_op.
     friend class script;
     static bool count_op(reader& source) NOEXCEPT;
+    static bool count_op(fast_reader& source) NOEXCEPT;
 
     static operation from_push_data(const chunk_cptr& data,
         bool minimal) NOEXCEPT;
@@ -166,6 +170,8 @@ private:
     static const chunk_cptr& no_data_cptr() NOEXCEPT;
     static const chunk_cptr& any_data_cptr() NOEXCEPT;
     static uint32_t read_data_size(opcode code, reader& source) NOEXCEPT;
+    static uint32_t read_data_size(opcode code,
+        fast_reader& source) NOEXCEPT;
     static inline opcode opcode_from_data(const data_chunk& push_data,
         bool minimal) NOEXCEPT
     {
@@ -177,7 +183,10 @@ private:
     size_t data_size() const NOEXCEPT;
     const data_chunk& get_data() const NOEXCEPT;
     const chunk_cptr& get_data_cptr() const NOEXCEPT;
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink) const NOEXCEPT;
 
     // Operation should not be stored as shared (adds 16 bytes).
     // copy: 8 + 2 * 64 + 1 = 18 bytes (vs. 16 when shared).
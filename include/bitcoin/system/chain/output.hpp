@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_OUTPUT_HPP
 
 #include <memory>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -55,6 +56,7 @@ public:
     output(stream::in::fast& stream) NOEXCEPT;
     output(std::istream& stream) NOEXCEPT;
     output(reader& source) NOEXCEPT;
+    output(fast_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -68,6 +70,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(fast_writer& sink) const NOEXCEPT;
+    void to_data(gather& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -97,11 +101,15 @@ public:
 protected:
     output(stream::in::fast&& stream) NOEXCEPT;
     output(reader&& source) NOEXCEPT;
+    output(fast_reader&& source) NOEXCEPT;
     output(uint64_t value, const chain::script::cptr& script,
         bool valid) NOEXCEPT;
 
 private:
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink) const NOEXCEPT;
     static size_t serialized_size(const chain::script& script,
         uint64_t value) NOEXCEPT;
 
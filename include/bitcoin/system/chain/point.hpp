@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <unordered_set>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -59,6 +60,7 @@ public:
     point(stream::in::fast& stream) NOEXCEPT;
     point(std::istream& stream) NOEXCEPT;
     point(reader& source) NOEXCEPT;
+    point(fast_reader& source) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -72,6 +74,8 @@ public:
     data_chunk to_data() const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
+    void to_data(fast_writer& sink) const NOEXCEPT;
+    void to_data(gather& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -87,11 +91,15 @@ public:
 protected:
     point(stream::in::fast&& stream) NOEXCEPT;
     point(reader&& source) NOEXCEPT;
+    point(fast_reader&& source) NOEXCEPT;
     point(hash_digest&& hash, uint32_t index, bool valid) NOEXCEPT;
     point(const hash_digest& hash, uint32_t index, bool valid) NOEXCEPT;
 
 private:
-    void assign_data(reader& source) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink) const NOEXCEPT;
 
     // The index is consensus-serialized as a fixed 4 bytes, however it is
     // effectively bound to 2^17 by the block byte size limit.
@@ -19,9 +19,11 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_HPP
 
+#include <atomic>
 #include <memory>
 #include <bitcoin/system/chain/enums/flags.hpp>
 #include <bitcoin/system/chain/enums/script_version.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -65,6 +67,13 @@ public:
     static bool is_coinbase_pattern(const operations& ops, size_t height) NOEXCEPT;
     static bool is_pay_multisig_pattern(const operations& ops) NOEXCEPT;
 
+    /// Serialized script patterns (equivalent to parsed operation patterns).
+    static constexpr bool is_witness_program_pattern(const data_chunk& bytes) NOEXCEPT;
+    static constexpr bool is_pay_key_hash_pattern(const data_chunk& bytes) NOEXCEPT;
+    static constexpr bool is_pay_script_hash_pattern(const data_chunk& bytes) NOEXCEPT;
+    static constexpr bool is_pay_witness_key_hash_pattern(const data_chunk& bytes) NOEXCEPT;
+    static constexpr bool is_pay_witness_script_hash_pattern(const data_chunk& bytes) NOEXCEPT;
+
     static inline operations to_pay_null_data_pattern(
         const data_slice& data) NOEXCEPT;
     static inline operations to_pay_public_key_pattern(
@@ -100,6 +109,7 @@ public:
     virtual ~script() NOEXCEPT;
 
     /// Metadata is defaulted on copy/assign.
+    /// Deserialized scripts retain only bytes until first ops() access.
     script(script&& other) NOEXCEPT;
     script(const script& other) NOEXCEPT;
     script(operations&& ops) NOEXCEPT;
@@ -109,6 +119,7 @@ public:
     script(stream::in::fast& stream, bool prefix) NOEXCEPT;
     script(std::istream& stream, bool prefix) NOEXCEPT;
     script(reader& source, bool prefix) NOEXCEPT;
+    script(fast_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     script(const std::string_view& mnemonic, bool bitcoind=false) NOEXCEPT;
@@ -129,6 +140,8 @@ public:
     data_chunk to_data(bool prefix) const NOEXCEPT;
     void to_data(std::ostream& stream, bool prefix) const NOEXCEPT;
     void to_data(writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(fast_writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(gather& sink, bool prefix) const NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     std::string to_string(uint32_t active_flags,
@@ -147,6 +160,9 @@ public:
     bool is_underflow() const NOEXCEPT;
     bool is_oversized() const NOEXCEPT;
     bool is_unspendable() const NOEXCEPT;
+
+    /// Parses operations upon first access of a deserialized script (thread
+    /// safe), pattern optimizations and serialization do not require parse.
     const operations& ops() const NOEXCEPT;
     size_t serialized_size(bool prefix) const NOEXCEPT;
 
@@ -171,21 +187,36 @@ public:
 protected:
     script(stream::in::fast&& stream, bool prefix) NOEXCEPT;
     script(reader&& source, bool prefix) NOEXCEPT;
+    script(fast_reader&& source, bool prefix) NOEXCEPT;
     script(const operations& ops, bool valid, bool easier, bool failer,
         bool roller, size_t size) NOEXCEPT;
 
 private:
+    static constexpr uint8_t unparsed = 0;
+    static constexpr uint8_t parsing = 1;
+    static constexpr uint8_t parsed = 2;
+
     static inline size_t op_size(size_t total, const operation& op) NOEXCEPT;
     static script from_operations(operations&& ops) NOEXCEPT;
     static script from_operations(const operations& ops) NOEXCEPT;
     static script from_string(const std::string_view& mnemonic,
         bool bitcoind=false) NOEXCEPT;
-    static size_t op_count(reader& source) NOEXCEPT;
+    template <typename Source>
+    static size_t op_count(Source& source) NOEXCEPT;
     static size_t serialized_size(const operations& ops) NOEXCEPT;
-    void assign_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool prefix) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink, bool prefix) const NOEXCEPT;
+    void assign_flags() NOEXCEPT;
+    bool is_parsed() const NOEXCEPT;
+    void parse() const NOEXCEPT;
 
     // Script should be stored as shared.
-    operations ops_;
+    // Deserialized bytes are retained and parsed to ops upon first access.
+    chunk_cptr bytes_;
+    mutable operations ops_;
+    mutable std::atomic<uint8_t> state_;
 
     // Cache, computed at construction.
     bool valid_;
@@ -33,12 +33,28 @@ namespace chain {
 class BC_API taproot
 {
 public:
+    /// A script path spend commitment (valid control block, output key, leaf).
+    struct commitment
+    {
+        tapscript control;
+        ec_xonly out_key;
+        hash_digest leaf;
+    };
+
+    typedef std_vector<commitment> commitments;
+
     static hash_digest leaf_hash(uint8_t version,
         const script& script) NOEXCEPT;
     static bool drop_annex(chunk_cptrs& stack) NOEXCEPT;
     static bool verify_commit(const tapscript& control,
         const ec_xonly& out_key, const hash_digest& leaf) NOEXCEPT;
 
+    /// Verify commitments, returns the index of the first invalid commitment
+    /// (or the commitment count if all are valid). Branch hashes are computed
+    /// across commitments by merkle path depth, and these and tweak hashes are
+    /// batched in vector lanes from precomputed tag midstates.
+    static size_t verify_commits(const commitments& batch) NOEXCEPT;
+
 protected:
     static hash_digest merkle_root(const tapscript::keys_t& keys,
         size_t count, const hash_digest& tapleaf_hash) NOEXCEPT;
@@ -48,6 +64,9 @@ protected:
         const hash_digest& second) NOEXCEPT;
     static hash_digest tweak_hash(const ec_xonly& key,
         const hash_digest& merkle) NOEXCEPT;
+    static hashes merkle_roots(const commitments& batch) NOEXCEPT;
+    static hashes tweak_hashes(const commitments& batch,
+        const hashes& roots) NOEXCEPT;
 };
 
 } // namespace chain
@@ -23,6 +23,7 @@
 #include <optional>
 #include <bitcoin/system/chain/enums/coverage.hpp>
 #include <bitcoin/system/chain/context.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
@@ -30,6 +31,8 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/script_cache.hpp>
+#include <bitcoin/system/machine/signature_batch.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
@@ -75,6 +78,7 @@ public:
     transaction(stream::in::fast& stream, bool witness) NOEXCEPT;
     transaction(std::istream& stream, bool witness) NOEXCEPT;
     transaction(reader& source, bool witness) NOEXCEPT;
+    transaction(fast_reader& source, bool witness) NOEXCEPT;
 
     /// Operators.
     /// -----------------------------------------------------------------------
@@ -88,6 +92,10 @@ public:
     data_chunk to_data(bool witness) const NOEXCEPT;
     void to_data(std::ostream& stream, bool witness) const NOEXCEPT;
     void to_data(writer& sink, bool witness) const NOEXCEPT;
+    void to_data(fast_writer& sink, bool witness) const NOEXCEPT;
+
+    /// Zero copy of retained bytes, witness form is a selection of the sink.
+    void to_data(gather& sink) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -126,6 +134,15 @@ public:
     /// Reference used to avoid copy, sets cache if not set.
     const hash_digest& get_hash(bool witness) const NOEXCEPT;
 
+    /// True if hash(witness) is cached.
+    bool has_hash(bool witness) const NOEXCEPT;
+
+    /// Precompute signature hash components common to all inputs (shared
+    /// hashes and preimage prefix midstates), if not precomputed. Taproot
+    /// components require that all prevouts are populated, otherwise taproot
+    /// signature hashing may still populate shared caches (not thread safe).
+    void set_sighash_precompute() const NOEXCEPT;
+
     /// Methods.
     /// -----------------------------------------------------------------------
 
@@ -169,12 +186,27 @@ public:
     code check() const NOEXCEPT;
     code check(const context& ctx) const NOEXCEPT;
     code accept(const context& ctx) const NOEXCEPT;
-    code connect(const context& ctx) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
+    /// Inputs are connected concurrently if concurrent (and more than one).
+    /// The first failure in input order is returned, as with serial connect.
+    code connect(const context& ctx, bool concurrent=false) const NOEXCEPT;
+
+    /// Terminal schnorr signature and taproot commitment verifications are
+    /// deferred to the batch, which must be verified by the caller (see
+    /// signature_batch::verify).
+    code connect(const context& ctx,
+        machine::signature_batch& batch) const NOEXCEPT;
+
+    /// Inputs with successful execution stored in the cache (by witness hash,
+    /// input index and flags) are skipped, and successful inputs are stored.
+    code connect(const context& ctx,
+        machine::script_cache& cache) const NOEXCEPT;
+
 protected:
     transaction(stream::in::fast&& stream, bool witness) NOEXCEPT;
     transaction(reader&& source, bool witness) NOEXCEPT;
+    transaction(fast_reader&& source, bool witness) NOEXCEPT;
     transaction(uint32_t version, const inputs_cptr& inputs,
         const outputs_cptr& outputs, uint32_t locktime, bool segregated,
         bool valid) NOEXCEPT;
@@ -237,6 +269,12 @@ protected:
     /// Requires input.metadata.spender_height.
     bool is_confirmed_double_spend(size_t height) const NOEXCEPT;
 
+    /// Signature hashing.
+    /// -----------------------------------------------------------------------
+
+    /// True if not segregated or set_sighash_precompute has completed.
+    bool is_sighash_complete() const NOEXCEPT;
+
 private:
     typedef struct { size_t nominal; size_t witnessed; } sizes;
     typedef struct
@@ -250,6 +288,20 @@ private:
         hash_digest amounts;
         hash_digest scripts;
     } only_cache;
+    typedef struct
+    {
+        // sha256x2(version || points || sequences).
+        accumulator<sha256> v0_all;
+
+        // sha256t(epoch || flags || version || locktime || points ||
+        // amounts || scripts || sequences || outputs), for flags 0x00|0x01.
+        accumulator<sha256> v1_default;
+        accumulator<sha256> v1_all;
+        bool taproot;
+
+        // All shared caches readable by signature hashing are populated.
+        bool complete;
+    } sighash_precompute;
 
     static bool segregated(const chain::inputs& inputs) NOEXCEPT;
     static bool segregated(const input_cptrs& inputs) NOEXCEPT;
@@ -257,12 +309,17 @@ private:
         const output_cptrs& outputs, bool segregated) NOEXCEPT;
 
     input_iterator input_at(uint32_t index) const NOEXCEPT;
-    void assign_data(reader& source, bool witness) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool witness) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink, bool witness) const NOEXCEPT;
     chain::points points() const NOEXCEPT;
 
     // delegated
     code connect_input(const context& ctx,
         const input_iterator& it) const NOEXCEPT;
+    code connect_input(const context& ctx, const input_iterator& it,
+        machine::signature_batch& batch) const NOEXCEPT;
 
     // Patterns.
     // ------------------------------------------------------------------------
@@ -283,6 +340,7 @@ private:
     hash_digest x1_base_hash_outputs() const NOEXCEPT;
     hash_digest v1_only_hash_amounts() const NOEXCEPT;
     hash_digest v1_only_hash_scripts() const NOEXCEPT;
+    accumulator<sha256> v1_midstate(uint8_t sighash_flags) const NOEXCEPT;
 
     // Set sha256 cache if not set, so not thread safe unless cached.
     const hash_digest& single_hash_points() const NOEXCEPT;
@@ -344,6 +402,7 @@ private:
     mutable std::shared_ptr<base_cache> x1_base_cache_{};
     mutable std::shared_ptr<base_cache> x2_base_cache_{};
     mutable std::shared_ptr<only_cache> v1_only_cache_{};
+    mutable std::shared_ptr<const sighash_precompute> sighash_precompute_{};
 };
 
 typedef std_vector<transaction> transactions;
@@ -20,9 +20,12 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_WITNESS_HPP
 
 #include <memory>
+#include <optional>
 #include <bitcoin/system/chain/annex.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/taproot.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -59,6 +62,7 @@ public:
     witness(stream::in::fast& stream, bool prefix) NOEXCEPT;
     witness(std::istream& stream, bool prefix) NOEXCEPT;
     witness(reader& source, bool prefix) NOEXCEPT;
+    witness(fast_reader& source, bool prefix) NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     witness(const std::string_view& mnemonic) NOEXCEPT;
@@ -74,10 +78,13 @@ public:
 
     /// Skip a witness (as if deserialized).
     static void skip(reader& source, bool prefix) NOEXCEPT;
+    static void skip(fast_reader& source, bool prefix) NOEXCEPT;
 
     data_chunk to_data(bool prefix) const NOEXCEPT;
     void to_data(std::ostream& stream, bool prefix) const NOEXCEPT;
     void to_data(writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(fast_writer& sink, bool prefix) const NOEXCEPT;
+    void to_data(gather& sink, bool prefix) const NOEXCEPT;
 
     // TODO: move to config serialization wrapper.
     std::string to_string() const NOEXCEPT;
@@ -90,6 +97,11 @@ public:
     const chunk_cptrs& stack() const NOEXCEPT;
     const chain::annex& annex() const NOEXCEPT;
 
+    /// Stack element as a view of its bytes (empty if out of range).
+    /// Elements deserialized from a buffer (fast_reader) are contiguous in a
+    /// single allocation, those read from a stream are separately allocated.
+    data_slice element(size_t index) const NOEXCEPT;
+
     /// Computed properties.
     /// serialized_size(true) returns one for an empty witness stack.
     size_t serialized_size(bool prefix) const NOEXCEPT;
@@ -111,15 +123,18 @@ public:
     bool extract_sigop_script(script& out_script,
         const script& program_script) const NOEXCEPT;
 
-    /// Script for witness validation.
+    /// Script for witness validation. If deferred is not null a tapscript
+    /// commitment is not verified, it is assigned to deferred (for batching).
     code extract_segwit(script::cptr& out_script, chunk_cptrs_ptr& out_stack,
         const script& program_script) const NOEXCEPT;
     code extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
-        chunk_cptrs_ptr& out_stack, const script& program_script) const NOEXCEPT;
+        chunk_cptrs_ptr& out_stack, const script& program_script,
+        std::optional<taproot::commitment>* deferred=nullptr) const NOEXCEPT;
 
 protected:
     witness(stream::in::fast&& stream, bool prefix) NOEXCEPT;
     witness(reader&& source, bool prefix) NOEXCEPT;
+    witness(fast_reader&& source, bool prefix) NOEXCEPT;
     witness(chunk_cptrs&& stack, bool valid) NOEXCEPT;
     witness(const chunk_cptrs& stack, bool valid) NOEXCEPT;
     witness(const chunk_cptrs& stack, bool valid, size_t size) NOEXCEPT;
@@ -127,7 +142,10 @@ protected:
 private:
     // TODO: move to config serialization wrapper.
     static witness from_string(const std::string_view& mnemonic) NOEXCEPT;
-    void assign_data(reader& source, bool prefix) NOEXCEPT;
+    template <typename Source>
+    void assign_data(Source& source, bool prefix) NOEXCEPT;
+    template <typename Sink>
+    void write_data(Sink& sink, bool prefix) const NOEXCEPT;
 
     // Witness should be stored as shared.
     chunk_cptrs stack_;
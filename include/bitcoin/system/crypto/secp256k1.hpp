@@ -249,6 +249,24 @@ BC_API bool verify_commitment(const ec_xonly& internal_key,
     const hash_digest& tweak, const ec_xonly& tweaked_key,
     bool tweaked_key_parity) NOEXCEPT;
 
+/// Schnorr batch verify
+/// ---------------------------------------------------------------------------
+/// libsecp256k1 does not expose multi-scalar (batch) verification, so each
+/// signature is verified independently, concurrently across the batch.
+
+typedef struct
+{
+    ec_xonly point;
+    hash_digest hash;
+    ec_signature signature;
+} verification;
+
+typedef std_vector<verification> verifications;
+
+/// Verify Schnorr signatures, returns the index of the first invalid signature
+/// (or the verification count if all are valid).
+BC_API size_t verify_signatures(const verifications& batch) NOEXCEPT;
+
 } // namespace schnorr
 } // namespace system
 } // namespace libbitcoin
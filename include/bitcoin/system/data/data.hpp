@@ -32,6 +32,7 @@
 #include <bitcoin/system/data/iterable.hpp>
 #include <bitcoin/system/data/memory.hpp>
 #include <bitcoin/system/data/no_fill_allocator.hpp>
+#include <bitcoin/system/data/shared_window.hpp>
 #include <bitcoin/system/data/string.hpp>
 
 #endif
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_SHARED_WINDOW_HPP
+#define LIBBITCOIN_SYSTEM_DATA_SHARED_WINDOW_HPP
+
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Persistent sliding window of values, with structural sharing.
+/// Copies share one append-only buffer, each viewing a contiguous range of
+/// it. push_back writes in place when the window ends at the buffer tip and
+/// there is unused capacity, otherwise the window is copied to a new buffer
+/// of twice its size. pop_front only advances the view. So copying a window
+/// and pushing/popping a value is O(1) amortized, and a linear sequence of
+/// derived windows of size n shares one allocation per n pushes. A divergent
+/// push (not at the tip) costs a copy of the window, as with a std::deque.
+/// Distinct instances are thread safe, a single instance is not.
+template <typename Type, if_default_constructible<Type> = true>
+class shared_window
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(shared_window);
+
+    using value_type = Type;
+    using const_iterator = const Type*;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// Minimum capacity of an allocated buffer.
+    static constexpr size_t minimum_capacity = 16;
+
+    shared_window() NOEXCEPT;
+
+    /// Append a value to the back of the window.
+    void push_back(const Type& value) NOEXCEPT;
+
+    /// Remove the value at the front of the window (shared buffer retained).
+    void pop_front() NOEXCEPT;
+
+    /// Properties.
+    bool empty() const NOEXCEPT;
+    size_t size() const NOEXCEPT;
+    size_t capacity() const NOEXCEPT;
+
+    /// Element access (unguarded).
+    const Type& front() const NOEXCEPT;
+    const Type& back() const NOEXCEPT;
+    const Type& operator[](size_t index) const NOEXCEPT;
+
+    /// Iteration (contiguous).
+    const_iterator begin() const NOEXCEPT;
+    const_iterator end() const NOEXCEPT;
+    const_iterator cbegin() const NOEXCEPT;
+    const_iterator cend() const NOEXCEPT;
+    const_reverse_iterator rbegin() const NOEXCEPT;
+    const_reverse_iterator rend() const NOEXCEPT;
+    const_reverse_iterator crbegin() const NOEXCEPT;
+    const_reverse_iterator crend() const NOEXCEPT;
+
+private:
+    // Fixed capacity, values below used are written at most once.
+    struct buffer
+    {
+        buffer(size_t capacity) NOEXCEPT;
+        bool claim(size_t position) NOEXCEPT;
+
+        std_vector<Type> values;
+        std::atomic<size_t> used;
+    };
+
+    void reallocate() NOEXCEPT;
+
+    std::shared_ptr<buffer> buffer_{};
+    size_t first_{};
+    size_t last_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Type, if_default_constructible<Type> If>
+#define CLASS shared_window<Type, If>
+
+#include <bitcoin/system/impl/data/shared_window.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
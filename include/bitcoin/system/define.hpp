@@ -95,6 +95,12 @@ namespace libbitcoin
     constexpr auto have_sha = false;
 #endif
 
+#if defined(HAVE_DISPATCH)
+    constexpr auto have_dispatch = true;
+#else
+    constexpr auto have_dispatch = false;
+#endif
+
 } // namespace libbitcoin
 
 /// Create bc namespace alias.
@@ -33,6 +33,15 @@ namespace system {
 class BC_API golomb
 {
 public:
+    /// Compressed set (not owned) with its element count and siphash key.
+    struct compressed_set
+    {
+        data_slice set;
+        uint64_t set_size;
+        siphash_key entropy;
+    };
+
+    typedef std::vector<compressed_set> compressed_sets;
 
     /// Golomb-coded set construction
     /// -----------------------------------------------------------------------
@@ -85,6 +94,15 @@ public:
         const siphash_key& entropy, uint8_t bits,
         uint64_t target_false_positive_rate) NOEXCEPT;
 
+    /// Multiple set intersection match
+    /// -----------------------------------------------------------------------
+
+    /// Match targets against each set, sets decoded concurrently.
+    /// Targets are deduplicated once and shared across all sets.
+    static std::vector<bool> match_many(const compressed_sets& sets,
+        const data_stack& targets, uint8_t bits,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
 private:
     static void encode(bitwriter& writer, uint64_t value,
         uint8_t modulo_exponent) NOEXCEPT;
@@ -92,9 +110,12 @@ private:
         uint8_t modulo_exponent) NOEXCEPT;
     static uint64_t hash_to_range(const data_slice& item,
         uint64_t bound, const siphash_key& key) NOEXCEPT;
+    static uint64_t to_range(uint64_t hash, uint64_t bound) NOEXCEPT;
     static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
         uint64_t set_size, uint64_t target_false_positive_rate,
         const siphash_key& key) NOEXCEPT;
+    static void radix_sort(std::vector<uint64_t>& values,
+        uint64_t bound) NOEXCEPT;
 };
 
 } // namespace system
@@ -21,10 +21,13 @@
 
 #include <algorithm>
 #include <memory>
+#include <string_view>
 #include <unordered_set>
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/algorithms.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -64,6 +67,7 @@ typedef std::shared_ptr<const mini_hash> mini_hash_cptr;
 
 /// Hashes are not pmr types, preserves constexpr.
 typedef std::vector<hash_digest> hashes;
+typedef std::vector<short_hash> short_hashes;
 
 /// Null-valued common hashes.
 constexpr long_hash null_long_hash{};
@@ -122,6 +126,11 @@ INLINE short_hash bitcoin_short_hash(const Type& data) NOEXCEPT;
 template <typename Type>
 INLINE data_chunk bitcoin_short_chunk(const Type& data) NOEXCEPT;
 
+/// Bitcoin short hashes of independent messages, vectorized across lanes
+/// for both sha256 and rmd160 where available [wallet, address indexing].
+INLINE short_hashes bitcoin_short_hash_batch(
+    const std::vector<data_slice>& messages) NOEXCEPT;
+
 /// Bitcoin hash (sha256(sha256)) [script, chain, wallet].
 template <typename Type>
 INLINE hash_digest bitcoin_hash(const Type& data) NOEXCEPT;
@@ -134,9 +143,18 @@ template <typename Type>
 INLINE data_chunk bitcoin_chunk(const Type& data) NOEXCEPT;
 
 /// Taproot tagged hashing (use sha256t_writer for best performance).
+/// Standard tags [bip340/341] resume from a compile-time midstate.
 INLINE hash_digest tagged_hash(const std::string& tag,
     const data_slice& message) NOEXCEPT;
 
+/// Taproot tagged hashing, resumed from the compile-time tag midstate.
+template <data_t Tag>
+INLINE hash_digest tagged_hash(const data_slice& message) NOEXCEPT;
+
+/// Taproot tagged hash midstate, sha256(tag) || sha256(tag) accumulated.
+template <data_t Tag>
+constexpr sha256::state_t tagged_midstate() NOEXCEPT;
+
 /// Merkle root from a bitcoin_hash set [chain].
 INLINE hash_digest merkle_root(hashes&& set) NOEXCEPT;
 
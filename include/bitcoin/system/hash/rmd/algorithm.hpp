@@ -23,6 +23,8 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/hash/algorithm.hpp>
+#include <bitcoin/system/hash/sha/dispatch.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 // algorithm.hpp file is the common include for rmd.
@@ -64,10 +66,13 @@ public:
     using block_t   = std_array<byte_t, RMD::block_words * RMD::word_bytes>;
     using digest_t  = std_array<byte_t, bytes<RMD::digest>>;
 
-    /// Block collection types.
+    /// Collection types.
     template <size_t Size>
     using ablocks_t = std_array<block_t, Size>;
     using iblocks_t = iterable<block_t>;
+    using digests_t = std::vector<digest_t>;
+    using halves_t  = std::vector<half_t>;
+    using slices_t  = std::vector<data_slice>;
 
     /// Constants (and count_t).
     /// -----------------------------------------------------------------------
@@ -102,7 +107,49 @@ public:
     /// Normalize streaming state (big-endian bytes).
     static constexpr digest_t normalize(const state_t& state) NOEXCEPT;
 
+    /// Batch hashing (independent messages, vectorized across lanes).
+    /// -----------------------------------------------------------------------
+    static digests_t hash_batch(const halves_t& halves) NOEXCEPT;
+    static digests_t hash_batch(const slices_t& messages) NOEXCEPT;
+
 protected:
+    /// Intrinsics constants.
+    /// -----------------------------------------------------------------------
+
+    static constexpr auto use_128 = bc::have_128;
+    static constexpr auto use_256 = bc::have_256;
+    static constexpr auto use_512 = bc::have_512;
+
+    /// Runtime kernel selection (rmd160 only, derived RMD is not dispatched).
+    static constexpr auto use_dispatch = bc::have_dispatch
+        && is_same_type<RMD, h160<>>;
+
+    template <size_t Lanes>
+    static constexpr auto is_valid_lanes =
+        (Lanes == 16u || Lanes == 8u || Lanes == 4u);
+
+    static constexpr auto min_lanes =
+        (use_128 ? bytes<128> :
+            (use_256 ? bytes<256> :
+                (use_512 ? bytes<512> : 0))) / RMD::word_bytes;
+
+    /// Intrinsics types.
+    /// -----------------------------------------------------------------------
+
+    /// Independent blocks are "striped" across the expanded words in xWords.
+    template <size_t Lanes, bool_if<is_valid_lanes<Lanes>> = true>
+    using xblock_t = std_array<words_t, Lanes>;
+
+    template <typename xWord, if_extended<xWord> = true>
+    using xwords_t = std_array<xWord, RMD::block_words>;
+
+    template <typename xWord, if_extended<xWord> = true>
+    using xstate_t = std_array<xWord, RMD::state_words>;
+
+    /// Retained expanded state for each of Lanes independent messages.
+    template <typename xWord, if_extended<xWord> = true>
+    using xstates_t = std_array<xstate_t<xWord>, capacity<xWord, word_t>>;
+
     /// Functions
     /// -----------------------------------------------------------------------
     
@@ -128,8 +175,9 @@ protected:
 
     template<size_t Round>
     INLINE static constexpr void round(auto& state, const auto& words) NOEXCEPT;
-    INLINE static constexpr void summarize(state_t& out, const state_t& batch1,
-        const state_t& batch2) NOEXCEPT;
+    INLINE static constexpr void summarize(auto& out, const auto& batch1,
+        const auto& batch2) NOEXCEPT;
+    static constexpr void compress_(auto& state, const auto& words) NOEXCEPT;
     static constexpr void compress(state_t& state, const words_t& words) NOEXCEPT;
     
     /// Parsing
@@ -144,6 +192,47 @@ protected:
     static constexpr void pad_half(words_t& words) NOEXCEPT;
     static constexpr void pad_n(words_t& words, count_t blocks) NOEXCEPT;
 
+    /// Batch
+    /// -----------------------------------------------------------------------
+    static constexpr size_t batch_blocks(size_t bytes) NOEXCEPT;
+    INLINE static void batch_block(block_t& block, const data_slice& message,
+        size_t index) NOEXCEPT;
+    static digest_t batch_hash(const data_slice& message) NOEXCEPT;
+
+    template <size_t Word, size_t Lanes>
+    INLINE static auto pack(const xblock_t<Lanes>& xblock) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static xstate_t<xWord> pack(const state_t& state) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void xinput(xwords_t<xWord>& xwords,
+        const xblock_t<capacity<xWord, word_t>>& xblock) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void xinput_half(xwords_t<xWord>& xwords,
+        const xblock_t<capacity<xWord, word_t>>& xblock) NOEXCEPT;
+
+    template <size_t Lane, typename xWord>
+    INLINE static digest_t unpack(const xstate_t<xWord>& xstate) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void xoutput(digests_t& digests,
+        const xstate_t<xWord>& xstate, size_t next) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void xoutput(digests_t& digests,
+        const xstates_t<xWord>& xstates, const size_t* order) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void batch_vector(digests_t& digests, const halves_t& halves,
+        size_t& next) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void batch_vector(digests_t& digests,
+        const slices_t& messages, const std::vector<size_t>& order,
+        size_t& next) NOEXCEPT;
+
 private:
     using pad_t = std_array<word_t, subtract(RMD::block_words,
         count_bytes / RMD::word_bytes)>;
@@ -161,6 +250,7 @@ private:
 #define CLASS algorithm<RMD, If>
 
 #include <bitcoin/system/impl/hash/rmd/algorithm.ipp>
+#include <bitcoin/system/impl/hash/rmd/algorithm_batch.ipp>
 
 #undef CLASS
 #undef TEMPLATE
@@ -23,6 +23,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/hash/algorithm.hpp>
+#include <bitcoin/system/hash/sha/dispatch.hpp>
 #include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
@@ -96,6 +97,7 @@ public:
     using ablocks_t = std_array<block_t, Size>;
     using iblocks_t = iterable<block_t>;
     using digests_t = std::vector<digest_t>;
+    using slices_t  = std::vector<data_slice>;
 
     /// Count types.
     /// -----------------------------------------------------------------------
@@ -161,6 +163,16 @@ public:
     static constexpr digests_t& merkle_hash(digests_t& digests) NOEXCEPT;
     static constexpr digest_t merkle_root(digests_t&& digests) NOEXCEPT;
 
+    /// Batch hashing (independent messages, vectorized for sha256/512).
+    /// -----------------------------------------------------------------------
+    static digests_t hash_batch(const slices_t& messages) NOEXCEPT;
+    static digests_t double_hash_batch(const slices_t& messages) NOEXCEPT;
+
+    /// Batch hashing resumed from a common midstate of whole blocks (such as
+    /// a tagged hash prefix), where blocks is the midstate's block count.
+    static digests_t hash_batch(const state_t& midstate, size_t blocks,
+        const slices_t& messages) NOEXCEPT;
+
 protected:
     /// Intrinsics constants.
     /// -----------------------------------------------------------------------
@@ -170,6 +182,10 @@ protected:
     static constexpr auto use_256 = Vector && bc::have_256;
     static constexpr auto use_512 = Vector && bc::have_512;
 
+    /// Runtime kernel selection (sha256 only, derived SHA is not dispatched).
+    static constexpr auto use_dispatch = Native && Vector && bc::have_dispatch
+        && is_same_type<SHA, h256<>>;
+
     template <size_t Lanes>
     static constexpr auto is_valid_lanes =
         (Lanes == 16u || Lanes == 8u || Lanes == 4u || Lanes == 2u);
@@ -196,6 +212,10 @@ protected:
     template <typename xWord, if_extended<xWord> = true>
     using xchunk_t = std_array<xWord, SHA::state_words>;
 
+    /// Retained expanded state for each of Lanes independent messages.
+    template <typename xWord, if_extended<xWord> = true>
+    using xstates_t = std_array<xstate_t<xWord>, capacity<xWord, word_t>>;
+
     /// Wide is casting of buffer_t to xWord for single block concurrency.
     /// This is not multi-block or block striping, just larger words.
     template <typename xWord, if_extended<xWord> = true>
@@ -310,6 +330,10 @@ protected:
     template <size_t Word, size_t Lanes>
     INLINE static auto pack(const xblock_t<Lanes>& xblock) NOEXCEPT;
 
+    template <typename xWord>
+    INLINE static void xinput(xbuffer_t<xWord>& xbuffer,
+        const xblock_t<capacity<xWord, word_t>>& xblock) NOEXCEPT;
+
     template <typename xWord>
     INLINE static void xinput(xbuffer_t<xWord>& xbuffer,
         iblocks_t& blocks) NOEXCEPT;
@@ -379,6 +403,33 @@ protected:
     constexpr static void merkle_hash_(digests_t& digests,
         size_t offset=zero) NOEXCEPT;
 
+    /// Batch hashing (fully vectorized for multiple messages).
+    /// -----------------------------------------------------------------------
+
+    static constexpr size_t batch_blocks(size_t bytes) NOEXCEPT;
+    INLINE static void batch_block(block_t& block, const data_slice& message,
+        size_t index, size_t prefix) NOEXCEPT;
+
+    template <bool Double>
+    static digest_t batch_hash(const state_t& midstate, size_t prefix,
+        const data_slice& message) NOEXCEPT;
+
+    template <bool Double, size_t Lane, typename xWord>
+    INLINE static digest_t batch_output(const xstate_t<xWord>& xstate) NOEXCEPT;
+
+    template <bool Double, typename xWord>
+    INLINE static void batch_output(digests_t& digests,
+        const xstates_t<xWord>& xstates, const size_t* order) NOEXCEPT;
+
+    template <bool Double, typename xWord, if_extended<xWord> = true>
+    INLINE static void batch_vector(digests_t& digests,
+        const state_t& midstate, size_t prefix, const slices_t& messages,
+        const std::vector<size_t>& order, size_t& next) NOEXCEPT;
+
+    template <bool Double>
+    static digests_t batch(const state_t& midstate, size_t prefix,
+        const slices_t& messages) NOEXCEPT;
+
     /// sigma0 vectorization (single blocks).
     /// -----------------------------------------------------------------------
 
@@ -477,6 +528,7 @@ BC_PUSH_WARNING(NO_UNGUARDED_POINTERS)
 BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
 BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 
+#include <bitcoin/system/impl/hash/sha/algorithm_batch.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_compress.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_konstant.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_double.ipp>
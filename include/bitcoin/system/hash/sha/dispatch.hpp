@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_DISPATCH_HPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_DISPATCH_HPP
+
+#include <tuple>
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/rmd/rmd160.hpp>
+#include <bitcoin/system/hash/sha/sha256.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+/// Instruction set of a hash kernel.
+/// Portable is the instruction set for which the library was compiled.
+enum class kernel : uint8_t
+{
+    portable,
+    avx2,
+    avx512,
+    native
+};
+
+/// Table of sha256, rmd160 and siphash kernels, selected at runtime when
+/// HAVE_DISPATCH.
+struct kernels
+{
+    using state_t = h256<>::state_t;
+    using digests_t = std::vector<std_array<uint8_t, bytes<h256<>::digest>>>;
+    using slices_t = std::vector<data_slice>;
+    using halves_t = std::vector<std_array<uint8_t, bytes<rmd::h160<>::size>>>;
+    using short_digests_t =
+        std::vector<std_array<uint8_t, bytes<rmd::h160<>::digest>>>;
+    using sip_key_t = std::tuple<uint64_t, uint64_t>;
+    using sip_hashes_t = std::vector<uint64_t>;
+
+    /// Accumulate a number of contiguous 64 byte blocks into state.
+    using iterate_t = void(*)(state_t& state, size_t blocks,
+        const uint8_t* data) NOEXCEPT;
+
+    /// Double hash a number of contiguous 64 byte digest pairs, writing the
+    /// 32 byte digests in place to the front of the buffer.
+    using merkle_t = void(*)(uint8_t* data, size_t pairs) NOEXCEPT;
+
+    /// Hash (or double hash) independent messages, each following a common
+    /// midstate of prefix bytes (whole blocks), into digests (message order).
+    using batch_t = void(*)(digests_t& digests, const state_t& midstate,
+        size_t prefix, const slices_t& messages, bool double_hash) NOEXCEPT;
+
+    /// rmd160 hash independent 32 byte halves (e.g. sha256 digests).
+    using rmd_halves_t = void(*)(short_digests_t& digests,
+        const halves_t& halves) NOEXCEPT;
+
+    /// rmd160 hash independent messages into digests (message order).
+    using rmd_batch_t = void(*)(short_digests_t& digests,
+        const slices_t& messages) NOEXCEPT;
+
+    /// siphash independent messages under one key (message order).
+    using sip_batch_t = void(*)(sip_hashes_t& hashes, const sip_key_t& key,
+        const slices_t& messages) NOEXCEPT;
+
+    kernel iterate_set;
+    iterate_t iterate;
+    kernel merkle_set;
+    merkle_t merkle;
+    kernel batch_set;
+    batch_t batch;
+    kernel rmd_set;
+    rmd_halves_t rmd_halves;
+    rmd_batch_t rmd_batch;
+    kernel sip_set;
+    sip_batch_t sip_batch;
+};
+
+/// Kernels for the instruction set, or portable if not available (compiled
+/// and supported by the cpu). All kernels are of the same instruction set.
+BC_API kernels dispatch(kernel set) NOEXCEPT;
+
+/// Optimal kernels of the available instruction sets, selected once (thread
+/// safe). Iteration prefers native, merkle and batch prefer avx512 (16 lanes).
+/// rmd160 and siphash (lanes only) prefer avx512, then avx2, then native.
+BC_API const kernels& dispatch() NOEXCEPT;
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
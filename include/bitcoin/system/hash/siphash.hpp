@@ -23,6 +23,7 @@
 #define LIBBITCOIN_SYSTEM_HASH_SIPHASH
 
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -38,6 +39,11 @@ BC_API uint64_t siphash(const siphash_key& key,
 BC_API uint64_t siphash(const half_hash& hash,
     const data_slice& message) NOEXCEPT;
 
+/// Hash each message under one key, messages striped across vector lanes
+/// (where available), with the remainder hashed serially.
+BC_API std::vector<uint64_t> siphash_batch(const siphash_key& key,
+    const std::vector<data_slice>& messages) NOEXCEPT;
+
 constexpr siphash_key to_siphash_key(const half_hash& hash) NOEXCEPT
 {
     const auto part = split(hash);
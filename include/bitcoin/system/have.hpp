@@ -103,6 +103,12 @@
     #endif
 #endif
 
+/// Runtime selection of hash kernels compiled with per-source XCPU flags.
+/// vc++: Per-source instruction set flags are not configured (not dispatched).
+#if defined(WITH_DISPATCH) && defined(HAVE_XCPU) && !defined(HAVE_MSC)
+    #define HAVE_DISPATCH
+#endif
+
 /// Platform features derived.
 /// ---------------------------------------------------------------------------
 
@@ -227,6 +227,86 @@ constexpr bool script::is_sign_script_hash_pattern(
         && !ops.back().data().empty();
 }
 
+// Serialized patterns.
+// ----------------------------------------------------------------------------
+// Each is satisfied by the bytes of a script iff the corresponding operations
+// pattern is satisfied by its parsed operations.
+
+constexpr bool script::is_witness_program_pattern(
+    const data_chunk& bytes) NOEXCEPT
+{
+    // The program is a minimal push, which for 2..40 bytes is push_size_n.
+    constexpr auto overhead = two;
+    return bytes.size() >= overhead + min_witness_program
+        && bytes.size() <= overhead + max_witness_program
+        && operation::is_nonnegative(static_cast<opcode>(bytes[0]))
+        && bytes[1] == bytes.size() - overhead;
+}
+
+constexpr bool script::is_pay_key_hash_pattern(const data_chunk& bytes) NOEXCEPT
+{
+    constexpr auto size = 20_u8;
+    constexpr auto op_dup = static_cast<uint8_t>(opcode::dup);
+    constexpr auto op_hash160 = static_cast<uint8_t>(opcode::hash160);
+    constexpr auto op_equalverify = static_cast<uint8_t>(opcode::equalverify);
+    constexpr auto op_checksig = static_cast<uint8_t>(opcode::checksig);
+    constexpr auto op_push_size_20 = static_cast<uint8_t>(opcode::push_size_20);
+    constexpr auto op_push_one = static_cast<uint8_t>(opcode::push_one_size);
+    constexpr auto op_push_two = static_cast<uint8_t>(opcode::push_two_size);
+    constexpr auto op_push_four = static_cast<uint8_t>(opcode::push_four_size);
+    static_assert(op_push_size_20 == short_hash_size);
+
+    const auto length = bytes.size();
+    if (length < 25u || length > 29u ||
+        bytes[0] != op_dup ||
+        bytes[1] != op_hash160 ||
+        bytes[length - 2u] != op_equalverify ||
+        bytes[length - 1u] != op_checksig)
+        return false;
+
+    // The hash may be pushed by any push-data opcode.
+    switch (length)
+    {
+        case 25u:
+            return bytes[2] == op_push_size_20;
+        case 26u:
+            return bytes[2] == op_push_one && bytes[3] == size;
+        case 27u:
+            return bytes[2] == op_push_two && bytes[3] == size &&
+                is_zero(bytes[4]);
+        case 29u:
+            return bytes[2] == op_push_four && bytes[3] == size &&
+                is_zero(bytes[4]) && is_zero(bytes[5]) && is_zero(bytes[6]);
+        default:
+            return false;
+    }
+}
+
+constexpr bool script::is_pay_script_hash_pattern(
+    const data_chunk& bytes) NOEXCEPT
+{
+    return bytes.size() == 23u
+        && bytes[0] == static_cast<uint8_t>(opcode::hash160)
+        && bytes[1] == static_cast<uint8_t>(opcode::push_size_20)
+        && bytes[22] == static_cast<uint8_t>(opcode::equal);
+}
+
+constexpr bool script::is_pay_witness_key_hash_pattern(
+    const data_chunk& bytes) NOEXCEPT
+{
+    return bytes.size() == 22u
+        && bytes[0] == static_cast<uint8_t>(opcode::push_size_0)
+        && bytes[1] == static_cast<uint8_t>(opcode::push_size_20);
+}
+
+constexpr bool script::is_pay_witness_script_hash_pattern(
+    const data_chunk& bytes) NOEXCEPT
+{
+    return bytes.size() == 34u
+        && bytes[0] == static_cast<uint8_t>(opcode::push_size_0)
+        && bytes[1] == static_cast<uint8_t>(opcode::push_size_32);
+}
+
 inline operations script::to_pay_null_data_pattern(
     const data_slice& data) NOEXCEPT
 {
@@ -378,15 +458,17 @@ inline size_t script::op_size(size_t total, const operation& op) NOEXCEPT
 // This is an optimization over using script::pattern.
 inline bool script::is_pay_to_witness(uint32_t active_flags) const NOEXCEPT
 {
-    return is_enabled(active_flags, flags::bip141_rule) &&
-        is_witness_program_pattern(ops());
+    return is_enabled(active_flags, flags::bip141_rule) && (bytes_ ?
+        is_witness_program_pattern(*bytes_) :
+        is_witness_program_pattern(ops()));
 }
 
 // This is an optimization over using script::pattern.
 inline bool script::is_pay_to_script_hash(uint32_t active_flags) const NOEXCEPT
 {
-    return is_enabled(active_flags, flags::bip16_rule) &&
-        is_pay_script_hash_pattern(ops());
+    return is_enabled(active_flags, flags::bip16_rule) && (bytes_ ?
+        is_pay_script_hash_pattern(*bytes_) :
+        is_pay_script_hash_pattern(ops()));
 }
 
 BC_POP_WARNING()
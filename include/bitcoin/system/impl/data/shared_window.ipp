@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_SHARED_WINDOW_IPP
+#define LIBBITCOIN_SYSTEM_DATA_SHARED_WINDOW_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// buffer
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+CLASS::buffer::
+buffer(size_t capacity) NOEXCEPT
+  : values(capacity), used(zero)
+{
+}
+
+// Only one window can extend the buffer from a given position.
+TEMPLATE
+bool CLASS::buffer::
+claim(size_t position) NOEXCEPT
+{
+    if (position == values.size())
+        return false;
+
+    auto expected = position;
+    return used.compare_exchange_strong(expected, add1(position),
+        std::memory_order_acq_rel);
+}
+
+// shared_window
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+CLASS::
+shared_window() NOEXCEPT
+{
+}
+
+TEMPLATE
+void CLASS::
+push_back(const Type& value) NOEXCEPT
+{
+    if (!buffer_ || !buffer_->claim(last_))
+        reallocate();
+
+    // The claimed element is not visible to any other window.
+    buffer_->values[last_++] = value;
+}
+
+TEMPLATE
+void CLASS::
+pop_front() NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    ++first_;
+}
+
+// Copy window to the front of a new buffer and claim its next element.
+TEMPLATE
+void CLASS::
+reallocate() NOEXCEPT
+{
+    const auto count = size();
+    const auto capacity = std::max(minimum_capacity, shift_left(add1(count)));
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto next = std::make_shared<buffer>(capacity);
+    BC_POP_WARNING()
+
+    std::copy(begin(), end(), next->values.begin());
+    next->used.store(add1(count), std::memory_order_release);
+    buffer_ = next;
+    first_ = zero;
+    last_ = count;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::
+empty() const NOEXCEPT
+{
+    return is_zero(size());
+}
+
+TEMPLATE
+size_t CLASS::
+size() const NOEXCEPT
+{
+    return last_ - first_;
+}
+
+TEMPLATE
+size_t CLASS::
+capacity() const NOEXCEPT
+{
+    return buffer_ ? buffer_->values.size() : zero;
+}
+
+// Element access.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+const Type& CLASS::
+front() const NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return *begin();
+}
+
+TEMPLATE
+const Type& CLASS::
+back() const NOEXCEPT
+{
+    BC_ASSERT(!empty());
+    return *std::prev(end());
+}
+
+TEMPLATE
+const Type& CLASS::
+operator[](size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < size());
+    return *std::next(begin(), index);
+}
+
+// Iteration.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+typename CLASS::const_iterator CLASS::
+begin() const NOEXCEPT
+{
+    return buffer_ ? std::next(buffer_->values.data(), first_) : nullptr;
+}
+
+TEMPLATE
+typename CLASS::const_iterator CLASS::
+end() const NOEXCEPT
+{
+    return buffer_ ? std::next(buffer_->values.data(), last_) : nullptr;
+}
+
+TEMPLATE
+typename CLASS::const_iterator CLASS::
+cbegin() const NOEXCEPT
+{
+    return begin();
+}
+
+TEMPLATE
+typename CLASS::const_iterator CLASS::
+cend() const NOEXCEPT
+{
+    return end();
+}
+
+TEMPLATE
+typename CLASS::const_reverse_iterator CLASS::
+rbegin() const NOEXCEPT
+{
+    return const_reverse_iterator{ end() };
+}
+
+TEMPLATE
+typename CLASS::const_reverse_iterator CLASS::
+rend() const NOEXCEPT
+{
+    return const_reverse_iterator{ begin() };
+}
+
+TEMPLATE
+typename CLASS::const_reverse_iterator CLASS::
+crbegin() const NOEXCEPT
+{
+    return rbegin();
+}
+
+TEMPLATE
+typename CLASS::const_reverse_iterator CLASS::
+crend() const NOEXCEPT
+{
+    return rend();
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
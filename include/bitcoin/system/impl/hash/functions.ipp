@@ -147,6 +147,12 @@ INLINE data_chunk bitcoin_short_chunk(const Type& data) NOEXCEPT
     return accumulator<rmd160>::hash_chunk(accumulator<sha256>::hash(data));
 }
 
+INLINE short_hashes bitcoin_short_hash_batch(
+    const std::vector<data_slice>& messages) NOEXCEPT
+{
+    return rmd160::hash_batch(sha256::hash_batch(messages));
+}
+
 // Bitcoin hash (sha256(sha256)) [script, chain, wallet].
 template <typename Type>
 INLINE hash_digest bitcoin_hash(const Type& data) NOEXCEPT
@@ -183,10 +189,45 @@ INLINE data_chunk bitcoin_chunk(const Type& data) NOEXCEPT
     return accumulator<sha256>::double_hash_chunk(data);
 }
 
+// Taproot tagged hash midstate.
+template <data_t Tag>
+constexpr sha256::state_t tagged_midstate() NOEXCEPT
+{
+    // sha256(sha256(tag) || sha256(tag) || message) [bip340].
+    constexpr auto hash = sha256::simple_hash(Tag.data);
+    return sha256::midstate(hash, hash);
+}
+
 // Taproot tagged hash.
 INLINE hash_digest tagged_hash(const std::string& tag,
     const data_slice& message) NOEXCEPT
 {
+    // Midstates of standard tags [bip340/341], computed at compile time.
+    static constexpr std_array<std::pair<std::string_view, sha256::state_t>, 7>
+        tagged_midstates
+    {
+        {
+            { "BIP0340/challenge", tagged_midstate<"BIP0340/challenge">() },
+            { "BIP0340/aux", tagged_midstate<"BIP0340/aux">() },
+            { "BIP0340/nonce", tagged_midstate<"BIP0340/nonce">() },
+            { "TapLeaf", tagged_midstate<"TapLeaf">() },
+            { "TapBranch", tagged_midstate<"TapBranch">() },
+            { "TapTweak", tagged_midstate<"TapTweak">() },
+            { "TapSighash", tagged_midstate<"TapSighash">() }
+        }
+    };
+
+    // Standard tags skip the tag hash and its compression.
+    for (const auto& [name, midstate]: tagged_midstates)
+    {
+        if (name == tag)
+        {
+            accumulator<sha256> context{ midstate, one };
+            context.write(message.size(), message.data());
+            return context.flush();
+        }
+    }
+
     const auto hash = sha256_hash(tag);
     accumulator<sha256> context{};
     context.write(hash);
@@ -195,6 +236,16 @@ INLINE hash_digest tagged_hash(const std::string& tag,
     return context.flush();
 }
 
+// Taproot tagged hash (compile-time tag midstate).
+template <data_t Tag>
+INLINE hash_digest tagged_hash(const data_slice& message) NOEXCEPT
+{
+    constexpr auto midstate = tagged_midstate<Tag>();
+    accumulator<sha256> context{ midstate, one };
+    context.write(message.size(), message.data());
+    return context.flush();
+}
+
 // Merkle root from a bitcoin_hash set [chain].
 INLINE hash_digest merkle_root(hashes&& set) NOEXCEPT
 {
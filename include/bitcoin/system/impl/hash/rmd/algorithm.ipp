@@ -115,8 +115,9 @@ round(auto& a, auto b, auto c, auto d, auto x) NOEXCEPT
     constexpr auto s = K::rot[Round];
     constexpr auto k = K::get[Round / K::columns];
     constexpr auto fn = functor<Round, decltype(a)>();
+    constexpr auto w = RMD::word_bits;
 
-    a = /*b =*/ f::rol<s>(f::addc<k>(f::add(f::add(a, fn(b, c, d)), x)));
+    a = /*b =*/ f::rol<s, w>(f::addc<k, w>(f::add<w>(f::add<w>(a, fn(b, c, d)), x)));
 }
 
 TEMPLATE
@@ -127,9 +128,10 @@ round(auto& a, auto b, auto& c, auto d, auto e, auto x) NOEXCEPT
     constexpr auto s = K::rot[Round];
     constexpr auto k = K::get[Round / K::columns];
     constexpr auto fn = functor<Round, decltype(a)>();
+    constexpr auto w = RMD::word_bits;
 
-    a = /*b =*/ f::add(f::rol<s>(f::addc<k>(f::add(f::add(a, fn(b, c, d)), x))), e);
-    c = /*d =*/ f::rol<10>(c);
+    a = /*b =*/ f::add<w>(f::rol<s, w>(f::addc<k, w>(f::add<w>(f::add<w>(a, fn(b, c, d)), x))), e);
+    c = /*d =*/ f::rol<10, w>(c);
 }
 
 TEMPLATE
@@ -160,12 +162,13 @@ round(auto& state, const auto& words) NOEXCEPT
 
 TEMPLATE
 constexpr void CLASS::
-compress(state_t& state, const words_t& words) NOEXCEPT
+compress_(auto& state, const auto& words) NOEXCEPT
 {
+    using state_type = std::remove_cvref_t<decltype(state)>;
     constexpr auto offset = to_half(RMD::rounds);
 
-    state_t left{ state };
-    state_t right{ state };
+    state_type left{ state };
+    state_type right{ state };
 
     // RMD160:f0/f4, RMD128:f0/f3
     round< 0>(left, words); round< 0 + offset>(right, words);
@@ -263,27 +266,35 @@ compress(state_t& state, const words_t& words) NOEXCEPT
     summarize(state, left, right);
 }
 
+TEMPLATE
+constexpr void CLASS::
+compress(state_t& state, const words_t& words) NOEXCEPT
+{
+    compress_(state, words);
+}
+
 TEMPLATE
 INLINE constexpr void CLASS::
-summarize(state_t& state, const state_t& batch1,
-    const state_t& batch2) NOEXCEPT
+summarize(auto& state, const auto& batch1, const auto& batch2) NOEXCEPT
 {
+    constexpr auto w = RMD::word_bits;
+
     if constexpr (RMD::strength == 128)
     {
         const auto state_0_ = state[0];
-        state[0] = f::add(f::add(state[1], batch1[2]), batch2[3]);
-        state[1] = f::add(f::add(state[2], batch1[3]), batch2[0]);
-        state[2] = f::add(f::add(state[3], batch1[0]), batch2[1]);
-        state[3] = f::add(f::add(state_0_, batch1[1]), batch2[2]);
+        state[0] = f::add<w>(f::add<w>(state[1], batch1[2]), batch2[3]);
+        state[1] = f::add<w>(f::add<w>(state[2], batch1[3]), batch2[0]);
+        state[2] = f::add<w>(f::add<w>(state[3], batch1[0]), batch2[1]);
+        state[3] = f::add<w>(f::add<w>(state_0_, batch1[1]), batch2[2]);
     }
     else
     {
         const auto state_0_ = state[0];
-        state[0] = f::add(f::add(state[1], batch1[2]), batch2[3]);
-        state[1] = f::add(f::add(state[2], batch1[3]), batch2[4]);
-        state[2] = f::add(f::add(state[3], batch1[4]), batch2[0]);
-        state[3] = f::add(f::add(state[4], batch1[0]), batch2[1]);
-        state[4] = f::add(f::add(state_0_, batch1[1]), batch2[2]);
+        state[0] = f::add<w>(f::add<w>(state[1], batch1[2]), batch2[3]);
+        state[1] = f::add<w>(f::add<w>(state[2], batch1[3]), batch2[4]);
+        state[2] = f::add<w>(f::add<w>(state[3], batch1[4]), batch2[0]);
+        state[3] = f::add<w>(f::add<w>(state[4], batch1[0]), batch2[1]);
+        state[4] = f::add<w>(f::add<w>(state_0_, batch1[1]), batch2[2]);
     }
 }
 
@@ -0,0 +1,514 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_RMD_ALGORITHM_BATCH_IPP
+#define LIBBITCOIN_SYSTEM_HASH_RMD_ALGORITHM_BATCH_IPP
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// Batch hashing (independent messages striped across vector lanes).
+// ============================================================================
+// Each lane carries one message. Halves (such as sha256 digests in hash160)
+// share a constant pad, so only the leading half of each lane is packed.
+// Slices are ordered by padded block count so that lanes of a set complete
+// together. A lane that completes early retains a copy of the expanded state,
+// and subsequent rounds in that lane are waste.
+
+namespace libbitcoin {
+namespace system {
+namespace rmd {
+
+BC_PUSH_WARNING(NO_UNGUARDED_POINTERS)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// message padding
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+constexpr size_t CLASS::
+batch_blocks(size_t bytes) NOEXCEPT
+{
+    // Padded message must accommodate the pad byte and the bit count.
+    return ceilinged_divide(bytes + add1(count_bytes), array_count<block_t>);
+}
+
+TEMPLATE
+INLINE void CLASS::
+batch_block(block_t& block, const data_slice& message, size_t index) NOEXCEPT
+{
+    constexpr auto size = array_count<block_t>;
+    constexpr auto count = size - sizeof(uint64_t);
+    const auto bytes = message.size();
+    const auto start = index * size;
+
+    // Whole message block (no padding).
+    if ((start + size) <= bytes)
+    {
+        std::copy_n(std::next(message.data(), start), size, block.begin());
+        return;
+    }
+
+    block.fill(byte_t{});
+
+    // Partial message block.
+    if (start < bytes)
+        std::copy_n(std::next(message.data(), start), bytes - start,
+            block.begin());
+
+    // Pad byte immediately follows message (may be first byte of block).
+    if (start <= bytes)
+        block[bytes - start] = bit_hi<byte_t>;
+
+    // Message bit count is little-endian in the trailing bytes of last block.
+    if (index == sub1(batch_blocks(bytes)))
+        to_little<count>(block, to_bits(possible_wide_cast<uint64_t>(bytes)));
+}
+
+// serial form
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+typename CLASS::digest_t CLASS::
+batch_hash(const data_slice& message) NOEXCEPT
+{
+    const auto count = batch_blocks(message.size());
+
+    words_t words{};
+    block_t block{};
+    auto state = H::get;
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        batch_block(block, message, index);
+        input(words, block);
+        compress(state, words);
+    }
+
+    return output(state);
+}
+
+// packing
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <size_t Word, size_t Lanes>
+INLINE auto CLASS::
+pack(const xblock_t<Lanes>& xblock) NOEXCEPT
+{
+    using xword_t = to_extended<word_t, Lanes>;
+
+    // Words are native (little-endian conversion is performed by input).
+    if constexpr (Lanes == 4)
+    {
+        return f::set<xword_t>(
+            xblock[0][Word],
+            xblock[1][Word],
+            xblock[2][Word],
+            xblock[3][Word]);
+    }
+    else if constexpr (Lanes == 8)
+    {
+        return f::set<xword_t>(
+            xblock[0][Word],
+            xblock[1][Word],
+            xblock[2][Word],
+            xblock[3][Word],
+            xblock[4][Word],
+            xblock[5][Word],
+            xblock[6][Word],
+            xblock[7][Word]);
+    }
+    else if constexpr (Lanes == 16)
+    {
+        return f::set<xword_t>(
+            xblock[ 0][Word],
+            xblock[ 1][Word],
+            xblock[ 2][Word],
+            xblock[ 3][Word],
+            xblock[ 4][Word],
+            xblock[ 5][Word],
+            xblock[ 6][Word],
+            xblock[ 7][Word],
+            xblock[ 8][Word],
+            xblock[ 9][Word],
+            xblock[10][Word],
+            xblock[11][Word],
+            xblock[12][Word],
+            xblock[13][Word],
+            xblock[14][Word],
+            xblock[15][Word]);
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::template xstate_t<xWord> CLASS::
+pack(const state_t& state) NOEXCEPT
+{
+    xstate_t<xWord> xstate{};
+    xstate[0] = f::broadcast<xWord>(state[0]);
+    xstate[1] = f::broadcast<xWord>(state[1]);
+    xstate[2] = f::broadcast<xWord>(state[2]);
+    xstate[3] = f::broadcast<xWord>(state[3]);
+
+    if constexpr (RMD::strength == 160)
+    {
+        xstate[4] = f::broadcast<xWord>(state[4]);
+    }
+
+    return xstate;
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xinput_half(xwords_t<xWord>& xwords,
+    const xblock_t<capacity<xWord, word_t>>& xblock) NOEXCEPT
+{
+    xwords[0] = pack<0>(xblock);
+    xwords[1] = pack<1>(xblock);
+    xwords[2] = pack<2>(xblock);
+    xwords[3] = pack<3>(xblock);
+    xwords[4] = pack<4>(xblock);
+    xwords[5] = pack<5>(xblock);
+    xwords[6] = pack<6>(xblock);
+    xwords[7] = pack<7>(xblock);
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xinput(xwords_t<xWord>& xwords,
+    const xblock_t<capacity<xWord, word_t>>& xblock) NOEXCEPT
+{
+    xinput_half(xwords, xblock);
+    xwords[8] = pack<8>(xblock);
+    xwords[9] = pack<9>(xblock);
+    xwords[10] = pack<10>(xblock);
+    xwords[11] = pack<11>(xblock);
+    xwords[12] = pack<12>(xblock);
+    xwords[13] = pack<13>(xblock);
+    xwords[14] = pack<14>(xblock);
+    xwords[15] = pack<15>(xblock);
+}
+
+TEMPLATE
+template <size_t Lane, typename xWord>
+INLINE typename CLASS::digest_t CLASS::
+unpack(const xstate_t<xWord>& xstate) NOEXCEPT
+{
+    state_t state{};
+    state[0] = f::get<word_t, Lane>(xstate[0]);
+    state[1] = f::get<word_t, Lane>(xstate[1]);
+    state[2] = f::get<word_t, Lane>(xstate[2]);
+    state[3] = f::get<word_t, Lane>(xstate[3]);
+
+    if constexpr (RMD::strength == 160)
+    {
+        state[4] = f::get<word_t, Lane>(xstate[4]);
+    }
+
+    return output(state);
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xoutput(digests_t& digests, const xstate_t<xWord>& xstate,
+    size_t next) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    BC_ASSERT(digests.size() >= next + lanes);
+
+    const auto digest = std::next(digests.data(), next);
+    digest[0] = unpack<0>(xstate);
+    digest[1] = unpack<1>(xstate);
+    digest[2] = unpack<2>(xstate);
+    digest[3] = unpack<3>(xstate);
+
+    if constexpr (lanes >= 8)
+    {
+        digest[4] = unpack<4>(xstate);
+        digest[5] = unpack<5>(xstate);
+        digest[6] = unpack<6>(xstate);
+        digest[7] = unpack<7>(xstate);
+    }
+
+    if constexpr (lanes >= 16)
+    {
+        digest[8] = unpack<8>(xstate);
+        digest[9] = unpack<9>(xstate);
+        digest[10] = unpack<10>(xstate);
+        digest[11] = unpack<11>(xstate);
+        digest[12] = unpack<12>(xstate);
+        digest[13] = unpack<13>(xstate);
+        digest[14] = unpack<14>(xstate);
+        digest[15] = unpack<15>(xstate);
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xoutput(digests_t& digests, const xstates_t<xWord>& xstates,
+    const size_t* order) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    digests[order[0]] = unpack<0>(xstates[0]);
+    digests[order[1]] = unpack<1>(xstates[1]);
+    digests[order[2]] = unpack<2>(xstates[2]);
+    digests[order[3]] = unpack<3>(xstates[3]);
+
+    if constexpr (lanes >= 8)
+    {
+        digests[order[4]] = unpack<4>(xstates[4]);
+        digests[order[5]] = unpack<5>(xstates[5]);
+        digests[order[6]] = unpack<6>(xstates[6]);
+        digests[order[7]] = unpack<7>(xstates[7]);
+    }
+
+    if constexpr (lanes >= 16)
+    {
+        digests[order[8]] = unpack<8>(xstates[8]);
+        digests[order[9]] = unpack<9>(xstates[9]);
+        digests[order[10]] = unpack<10>(xstates[10]);
+        digests[order[11]] = unpack<11>(xstates[11]);
+        digests[order[12]] = unpack<12>(xstates[12]);
+        digests[order[13]] = unpack<13>(xstates[13]);
+        digests[order[14]] = unpack<14>(xstates[14]);
+        digests[order[15]] = unpack<15>(xstates[15]);
+    }
+}
+
+// vectorized form
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+batch_vector(digests_t& digests, const halves_t& halves, size_t& next) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>)
+    {
+        if ((halves.size() - next) >= lanes)
+        {
+            // TODO: expose const structs to avoid local static.
+            static const auto initial = pack<xWord>(H::get);
+
+            // The half block pad is common to all lanes.
+            constexpr auto pad = chunk_pad();
+            xwords_t<xWord> xwords{};
+            xwords[8] = f::broadcast<xWord>(pad[0]);
+            xwords[9] = f::broadcast<xWord>(pad[1]);
+            xwords[10] = f::broadcast<xWord>(pad[2]);
+            xwords[11] = f::broadcast<xWord>(pad[3]);
+            xwords[12] = f::broadcast<xWord>(pad[4]);
+            xwords[13] = f::broadcast<xWord>(pad[5]);
+            xwords[14] = f::broadcast<xWord>(pad[6]);
+            xwords[15] = f::broadcast<xWord>(pad[7]);
+
+            xblock_t<lanes> xblock{};
+
+            do
+            {
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    input(xblock[lane], halves[next + lane]);
+
+                auto xstate = initial;
+                xinput_half(xwords, xblock);
+                compress_(xstate, xwords);
+                xoutput(digests, xstate, next);
+                next += lanes;
+            }
+            while ((halves.size() - next) >= lanes);
+        }
+    }
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+batch_vector(digests_t& digests, const slices_t& messages,
+    const std::vector<size_t>& order, size_t& next) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>)
+    {
+        if ((messages.size() - next) >= lanes)
+        {
+            // TODO: expose const structs to avoid local static.
+            static const auto initial = pack<xWord>(H::get);
+
+            block_t block{};
+            xwords_t<xWord> xwords{};
+            xblock_t<lanes> xblock{};
+            xstates_t<xWord> xstates{};
+            std_array<size_t, lanes> counts{};
+
+            do
+            {
+                const auto set = std::next(order.data(), next);
+
+                // Set is ordered by block count, so last lane is the longest.
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    counts[lane] = batch_blocks(messages[set[lane]].size());
+
+                auto xstate = initial;
+                for (size_t index = 0; index < counts.back(); ++index)
+                {
+                    // Completed lanes retain stale words (waste is ignored).
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        if (index < counts[lane])
+                        {
+                            batch_block(block, messages[set[lane]], index);
+                            input(xblock[lane], block);
+                        }
+                    }
+
+                    xinput(xwords, xblock);
+                    compress_(xstate, xwords);
+
+                    // Capture expanded state for each lane completed here.
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        if (counts[lane] == add1(index))
+                            xstates[lane] = xstate;
+                }
+
+                xoutput(digests, xstates, set);
+                next += lanes;
+            }
+            while ((messages.size() - next) >= lanes);
+        }
+    }
+}
+
+// public
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hash_batch(const halves_t& halves) NOEXCEPT
+{
+    if constexpr (use_dispatch)
+    {
+        // Runtime selected kernel (avx512, avx2, native or portable).
+        digests_t digests{};
+        sha::dispatch().rmd_halves(digests, halves);
+        return digests;
+    }
+
+    digests_t digests(halves.size());
+    auto next = zero;
+
+    if constexpr (use_128 || use_256 || use_512)
+    {
+        if (halves.size() >= min_lanes)
+        {
+            if constexpr (use_512)
+                batch_vector<xint512_t>(digests, halves, next);
+
+            if constexpr (use_256)
+                batch_vector<xint256_t>(digests, halves, next);
+
+            if constexpr (use_128)
+                batch_vector<xint128_t>(digests, halves, next);
+        }
+    }
+
+    // Complete remaining halves using normal form.
+    for (; next < halves.size(); ++next)
+        digests[next] = hash(halves[next]);
+
+    return digests;
+}
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hash_batch(const slices_t& messages) NOEXCEPT
+{
+    if constexpr (use_dispatch)
+    {
+        // Runtime selected kernel (avx512, avx2, native or portable).
+        digests_t digests{};
+        sha::dispatch().rmd_batch(digests, messages);
+        return digests;
+    }
+
+    digests_t digests(messages.size());
+
+    if constexpr (use_128 || use_256 || use_512)
+    {
+        if (messages.size() >= min_lanes)
+        {
+            // Stable order by padded block count (longest lanes together).
+            std::vector<size_t> order(messages.size());
+            std::iota(order.begin(), order.end(), zero);
+            std::stable_sort(order.begin(), order.end(),
+                [&](size_t left, size_t right) NOEXCEPT
+                {
+                    return messages[left].size() < messages[right].size();
+                });
+
+            auto next = zero;
+
+            if constexpr (use_512)
+                batch_vector<xint512_t>(digests, messages, order, next);
+
+            if constexpr (use_256)
+                batch_vector<xint256_t>(digests, messages, order, next);
+
+            if constexpr (use_128)
+                batch_vector<xint128_t>(digests, messages, order, next);
+
+            // Complete remaining messages using normal form.
+            for (; next < messages.size(); ++next)
+                digests[order[next]] = batch_hash(messages[order[next]]);
+
+            return digests;
+        }
+    }
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        digests[index] = batch_hash(messages[index]);
+
+    return digests;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace rmd
+} // namespace system
+} // namespace libbitcoin
+
+#endif
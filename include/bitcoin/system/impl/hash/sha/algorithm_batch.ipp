@@ -0,0 +1,337 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_BATCH_IPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_BATCH_IPP
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// Batch hashing (independent messages striped across vector lanes).
+// ============================================================================
+// Each lane carries one message. Messages are ordered by padded block count so
+// that lanes of a set complete together. A lane that completes early retains
+// a copy of the expanded state, and subsequent rounds in that lane are waste.
+// All lanes start from a common state, the initial state or a midstate of
+// prefix bytes (whole blocks), where the prefix is included in the bit count.
+// No batch vectorization for sha160 (expanded state requires chunk_t).
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+// message padding
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+constexpr size_t CLASS::
+batch_blocks(size_t bytes) NOEXCEPT
+{
+    // Padded message must accommodate the pad byte and the bit count.
+    return ceilinged_divide(bytes + add1(count_bytes), array_count<block_t>);
+}
+
+TEMPLATE
+INLINE void CLASS::
+batch_block(block_t& block, const data_slice& message, size_t index,
+    size_t prefix) NOEXCEPT
+{
+    constexpr auto size = array_count<block_t>;
+    constexpr auto count = size - sizeof(uint64_t);
+    const auto bytes = message.size();
+    const auto start = index * size;
+
+    // Whole message block (no padding).
+    if ((start + size) <= bytes)
+    {
+        std::copy_n(std::next(message.data(), start), size, block.begin());
+        return;
+    }
+
+    block.fill(byte_t{});
+
+    // Partial message block.
+    if (start < bytes)
+        std::copy_n(std::next(message.data(), start), bytes - start,
+            block.begin());
+
+    // Pad byte immediately follows message (may be first byte of block).
+    if (start <= bytes)
+        block[bytes - start] = bit_hi<byte_t>;
+
+    // Message bit count is big-endian in the trailing bytes of last block.
+    // Excess count_t high order bytes (zero) are limited to 2^64 bits.
+    if (index == sub1(batch_blocks(bytes)))
+        to_big<count>(block,
+            to_bits(possible_wide_cast<uint64_t>(prefix + bytes)));
+}
+
+// serial form
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <bool Double>
+typename CLASS::digest_t CLASS::
+batch_hash(const state_t& midstate, size_t prefix,
+    const data_slice& message) NOEXCEPT
+{
+    constexpr auto size = array_count<block_t>;
+    const auto whole = message.size() / size;
+    const auto count = batch_blocks(message.size());
+
+    auto state = midstate;
+
+    // Whole blocks are iterated in place (optimal for native/vector).
+    if (!is_zero(whole))
+    {
+        iblocks_t blocks{ whole * size, message.data() };
+        iterate(state, blocks);
+    }
+
+    // Remaining one or two blocks are padded copies.
+    block_t block{};
+    for (auto index = whole; index < count; ++index)
+    {
+        batch_block(block, message, index, prefix);
+        accumulate(state, block);
+    }
+
+    if constexpr (Double)
+        return finalize_second(state);
+    else
+        return output(state);
+}
+
+// vectorized form
+// ----------------------------------------------------------------------------
+// protected
+
+TEMPLATE
+template <bool Double, size_t Lane, typename xWord>
+INLINE typename CLASS::digest_t CLASS::
+batch_output(const xstate_t<xWord>& xstate) NOEXCEPT
+{
+    const state_t state
+    {
+        f::get<word_t, Lane>(xstate[0]),
+        f::get<word_t, Lane>(xstate[1]),
+        f::get<word_t, Lane>(xstate[2]),
+        f::get<word_t, Lane>(xstate[3]),
+        f::get<word_t, Lane>(xstate[4]),
+        f::get<word_t, Lane>(xstate[5]),
+        f::get<word_t, Lane>(xstate[6]),
+        f::get<word_t, Lane>(xstate[7])
+    };
+
+    // Second hash is not vectorized, as lanes complete independently.
+    if constexpr (Double)
+        return finalize_second(state);
+    else
+        return output(state);
+}
+
+TEMPLATE
+template <bool Double, typename xWord>
+INLINE void CLASS::
+batch_output(digests_t& digests, const xstates_t<xWord>& xstates,
+    const size_t* order) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+
+    digests[order[0]] = batch_output<Double, 0>(xstates[0]);
+    digests[order[1]] = batch_output<Double, 1>(xstates[1]);
+
+    if constexpr (lanes >= 4)
+    {
+        digests[order[2]] = batch_output<Double, 2>(xstates[2]);
+        digests[order[3]] = batch_output<Double, 3>(xstates[3]);
+    }
+
+    if constexpr (lanes >= 8)
+    {
+        digests[order[4]] = batch_output<Double, 4>(xstates[4]);
+        digests[order[5]] = batch_output<Double, 5>(xstates[5]);
+        digests[order[6]] = batch_output<Double, 6>(xstates[6]);
+        digests[order[7]] = batch_output<Double, 7>(xstates[7]);
+    }
+
+    if constexpr (lanes >= 16)
+    {
+        digests[order[8]] = batch_output<Double, 8>(xstates[8]);
+        digests[order[9]] = batch_output<Double, 9>(xstates[9]);
+        digests[order[10]] = batch_output<Double, 10>(xstates[10]);
+        digests[order[11]] = batch_output<Double, 11>(xstates[11]);
+        digests[order[12]] = batch_output<Double, 12>(xstates[12]);
+        digests[order[13]] = batch_output<Double, 13>(xstates[13]);
+        digests[order[14]] = batch_output<Double, 14>(xstates[14]);
+        digests[order[15]] = batch_output<Double, 15>(xstates[15]);
+    }
+}
+
+TEMPLATE
+template <bool Double, typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+batch_vector(digests_t& digests, const state_t& midstate, size_t prefix,
+    const slices_t& messages, const std::vector<size_t>& order,
+    size_t& next) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    static_assert(is_valid_lanes<lanes>);
+
+    if constexpr (have<xWord>)
+    {
+        if ((messages.size() - next) >= lanes)
+        {
+            const auto initial = pack<xWord>(midstate);
+
+            xbuffer_t<xWord> xbuffer{};
+            xblock_t<lanes> xblock{};
+            xstates_t<xWord> xstates{};
+            std_array<size_t, lanes> counts{};
+
+            do
+            {
+                const auto set = std::next(order.data(), next);
+
+                // Set is ordered by block count, so last lane is the longest.
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    counts[lane] = batch_blocks(messages[set[lane]].size());
+
+                auto xstate = initial;
+                for (size_t block = 0; block < counts.back(); ++block)
+                {
+                    // Completed lanes retain stale blocks (waste is ignored).
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        if (block < counts[lane])
+                            batch_block(array_cast<byte_t>(xblock[lane]),
+                                messages[set[lane]], block, prefix);
+
+                    xinput(xbuffer, xblock);
+                    schedule_(xbuffer);
+                    compress_(xstate, xbuffer);
+
+                    // Capture expanded state for each lane completed here.
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        if (counts[lane] == add1(block))
+                            xstates[lane] = xstate;
+                }
+
+                batch_output<Double>(digests, xstates, set);
+                next += lanes;
+            }
+            while ((messages.size() - next) >= lanes);
+        }
+    }
+}
+
+TEMPLATE
+template <bool Double>
+typename CLASS::digests_t CLASS::
+batch(const state_t& midstate, size_t prefix,
+    const slices_t& messages) NOEXCEPT
+{
+    if constexpr (use_dispatch)
+    {
+        // Runtime selected kernel (avx512, native, avx2 or portable).
+        digests_t digests{};
+        dispatch().batch(digests, midstate, prefix, messages, Double);
+        return digests;
+    }
+
+    digests_t digests(messages.size());
+
+    if constexpr (vector && is_same_type<state_t, chunk_t>)
+    {
+        if (messages.size() >= min_lanes)
+        {
+            // Stable order by padded block count (longest lanes together).
+            std::vector<size_t> order(messages.size());
+            std::iota(order.begin(), order.end(), zero);
+            std::stable_sort(order.begin(), order.end(),
+                [&](size_t left, size_t right) NOEXCEPT
+                {
+                    return messages[left].size() < messages[right].size();
+                });
+
+            auto next = zero;
+
+            // Always use if available.
+            if constexpr (use_512)
+                batch_vector<Double, xint512_t>(digests, midstate, prefix,
+                    messages, order, next);
+
+            // Only use if shani is not available.
+            if constexpr (use_256 && !native)
+                batch_vector<Double, xint256_t>(digests, midstate, prefix,
+                    messages, order, next);
+
+            // Only use if shani is not available.
+            if constexpr (use_128 && !native)
+                batch_vector<Double, xint128_t>(digests, midstate, prefix,
+                    messages, order, next);
+
+            // Complete remaining messages using normal form.
+            for (; next < messages.size(); ++next)
+                digests[order[next]] = batch_hash<Double>(midstate, prefix,
+                    messages[order[next]]);
+
+            return digests;
+        }
+    }
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        digests[index] = batch_hash<Double>(midstate, prefix,
+            messages[index]);
+
+    return digests;
+}
+
+// public
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hash_batch(const slices_t& messages) NOEXCEPT
+{
+    return batch<false>(H::get, zero, messages);
+}
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+double_hash_batch(const slices_t& messages) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+    return batch<true>(H::get, zero, messages);
+}
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hash_batch(const state_t& midstate, size_t blocks,
+    const slices_t& messages) NOEXCEPT
+{
+    return batch<false>(midstate, blocks * array_count<block_t>, messages);
+}
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
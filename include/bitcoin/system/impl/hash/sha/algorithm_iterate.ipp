@@ -90,11 +90,9 @@ pack(const xblock_t<Lanes>& xblock) NOEXCEPT
 TEMPLATE
 template <typename xWord>
 INLINE void CLASS::
-xinput(xbuffer_t<xWord>& xbuffer, iblocks_t& blocks) NOEXCEPT
+xinput(xbuffer_t<xWord>& xbuffer,
+    const xblock_t<capacity<xWord, word_t>>& xblock) NOEXCEPT
 {
-    constexpr auto lanes = capacity<xWord, word_t>;
-
-    const auto& xblock = array_cast<words_t>(blocks.template to_array<lanes>());
     xbuffer[0] = pack<0>(xblock);
     xbuffer[1] = pack<1>(xblock);
     xbuffer[2] = pack<2>(xblock);
@@ -111,6 +109,15 @@ xinput(xbuffer_t<xWord>& xbuffer, iblocks_t& blocks) NOEXCEPT
     xbuffer[13] = pack<13>(xblock);
     xbuffer[14] = pack<14>(xblock);
     xbuffer[15] = pack<15>(xblock);
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+xinput(xbuffer_t<xWord>& xbuffer, iblocks_t& blocks) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    xinput(xbuffer, array_cast<words_t>(blocks.template to_array<lanes>()));
     blocks.template advance<lanes>();
 }
 
@@ -318,7 +325,12 @@ TEMPLATE
 INLINE void CLASS::
 iterate(state_t& state, iblocks_t& blocks) NOEXCEPT
 {
-    if constexpr (native)
+    if constexpr (use_dispatch)
+    {
+        // Runtime selected kernel (native, avx512, avx2 or portable).
+        dispatch().iterate(state, blocks.size(), blocks.data());
+    }
+    else if constexpr (native)
     {
         iterate_native(state, blocks);
     }
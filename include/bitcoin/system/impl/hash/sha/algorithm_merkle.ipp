@@ -458,6 +458,15 @@ merkle_hash(digests_t& digests) NOEXCEPT
     {
         merkle_hash_(digests);
     }
+    else if constexpr (use_dispatch)
+    {
+        // Runtime selected kernel (avx512, native, avx2 or portable).
+        const auto pairs = to_half(digests.size());
+        if (!is_zero(pairs))
+            dispatch().merkle(digests.front().data(), pairs);
+
+        digests.resize(pairs);
+    }
     else if constexpr (vector)
     {
         // Merkle block vectorization is applied at 16/8/4 lanes (as available)
@@ -989,10 +989,22 @@ TEMPLATE
 inline error::op_error_t CLASS::
 op_check_sig() NOEXCEPT
 {
-    const auto ec = op_check_sig_verify();
+    // Signature failure is terminal for taproot key path (clean stack), and
+    // for tapscript (non-empty signature), so these are deferrable.
+    const auto key_path = state::is_key_path();
+    const auto tapscript = !key_path && state::is_enabled(flags::bip342_rule);
+    const auto ec = op_check_sig_verify(key_path ?
+        code{ error::stack_false } : (tapscript ?
+            code{ error::op_check_sig_verify5 } : code{}));
     if (ec == error::op_check_sig_empty_key)
         return ec;
 
+    // BIP342: if signature is empty, false is pushed, otherwise any failure
+    // MUST fail and end (key path failure remains stack_false).
+    if (tapscript && ec != error::op_success &&
+        ec != error::op_check_sig_verify2)
+        return ec;
+
     // BIP66: if DER encoding invalid script MUST fail and end.
     const auto bip66 = state::is_enabled(flags::bip66_rule);
     if (bip66 && ec == error::op_check_sig_parse_signature)
@@ -1004,7 +1016,7 @@ op_check_sig() NOEXCEPT
 
 TEMPLATE
 inline error::op_error_t CLASS::
-op_check_sig_verify() NOEXCEPT
+op_check_sig_verify(const code& terminal) NOEXCEPT
 {
     if (state::stack_size() < 2u)
         return error::op_check_sig_verify1;
@@ -1021,6 +1033,11 @@ op_check_sig_verify() NOEXCEPT
         if (endorsement->empty())
             return error::op_check_sig_verify2;
 
+        // If signature not empty, opcode counted toward sigops budget.
+        // This applies to all key types, and precedes validation.
+        if (!state::sigops_increment())
+            return error::op_check_sig_verify6;
+
         // If public key is 32 bytes it is a bip340 schnorr key.
         // If signature is not empty, it is validated against public key.
         if (key->size() == schnorr::public_key_size)
@@ -1037,12 +1054,8 @@ op_check_sig_verify() NOEXCEPT
                 return error::op_check_sig_verify4;
 
             // Verify schnorr signature against public key and signature hash.
-            if (!schnorr::verify_signature(*key, hash, sig))
+            if (!state::verify_schnorr(*key, hash, sig, terminal))
                 return error::op_check_sig_verify5;
-
-            // If signature not empty, opcode counted toward sigops budget.
-            if (!state::sigops_increment())
-                return error::op_check_sig_verify6;
         }
 
         // If public key size is neither 0 nor 32 bytes, it is an unknown type.
@@ -1311,7 +1324,7 @@ op_check_sig_add() NOEXCEPT
         return error::op_check_schnorr_sig5;
 
     // Verify schnorr signature against public key and signature hash.
-    if (!schnorr::verify_signature(*key, hash, sig))
+    if (!state::verify_schnorr(*key, hash, sig, error::op_check_schnorr_sig6))
         return error::op_check_schnorr_sig6;
 
     // If signature not empty, opcode counted toward sigops budget.
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_MACHINE_INTERPRETER_CONNECT_IPP
 
 #include <iterator>
+#include <optional>
 #include <utility>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -48,6 +49,42 @@ TEMPLATE
 code CLASS::
 connect(const chain::context& state, const chain::transaction& tx,
     const input_iterator& it) NOEXCEPT
+{
+    return trace_input(state, tx, it, nullptr);
+}
+
+TEMPLATE
+code CLASS::
+connect(const chain::context& state, const chain::transaction& tx,
+    const input_iterator& it, signature_batch& batch) NOEXCEPT
+{
+    return trace_input(state, tx, it, &batch);
+}
+
+// static/protected
+TEMPLATE
+code CLASS::trace_input(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it,
+    signature_batch* batch) NOEXCEPT
+{
+    if constexpr (Trace::enabled)
+    {
+        const auto start = Trace::clock::now();
+        const auto ec = connect_input(state, tx, it, batch);
+        Trace::record(Trace::classify(**it), Trace::clock::now() - start);
+        return ec;
+    }
+    else
+    {
+        return connect_input(state, tx, it, batch);
+    }
+}
+
+// static/protected
+TEMPLATE
+code CLASS::connect_input(const chain::context& state,
+    const chain::transaction& tx, const input_iterator& it,
+    signature_batch* batch) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
@@ -74,7 +111,7 @@ connect(const chain::context& state, const chain::transaction& tx,
     else if (prevout->is_pay_to_script_hash(state.flags))
     {
         // Because output script pushed script hash program [bip16].
-        if ((ec = connect_embedded(state, tx, it, in_program)))
+        if ((ec = connect_embedded(state, tx, it, in_program, batch)))
             return ec;
     }
     else if (prevout->is_pay_to_witness(state.flags))
@@ -84,7 +121,7 @@ connect(const chain::context& state, const chain::transaction& tx,
             return error::dirty_witness;
 
         // Because output script pushed version and witness program [bip141].
-        if ((ec = connect_witness(state, tx, it, *prevout, false)))
+        if ((ec = connect_witness(state, tx, it, *prevout, false, batch)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -100,7 +137,7 @@ connect(const chain::context& state, const chain::transaction& tx,
 TEMPLATE
 code CLASS::connect_embedded(const chain::context& state,
     const chain::transaction& tx, const input_iterator& it,
-    interpreter& in_program) NOEXCEPT
+    interpreter& in_program, signature_batch* batch) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
@@ -129,7 +166,7 @@ code CLASS::connect_embedded(const chain::context& state,
             return error::dirty_witness;
 
         // Because output script pushed version/witness program [bip141].
-        if ((ec = connect_witness(state, tx, it, *embedded, true)))
+        if ((ec = connect_witness(state, tx, it, *embedded, true, batch)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -145,7 +182,8 @@ code CLASS::connect_embedded(const chain::context& state,
 TEMPLATE
 code CLASS::connect_witness(const chain::context& state,
     const chain::transaction& tx, const input_iterator& it,
-    const chain::script& prevout, bool embedded) NOEXCEPT
+    const chain::script& prevout, bool embedded,
+    signature_batch* batch) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
@@ -191,11 +229,18 @@ code CLASS::connect_witness(const chain::context& state,
             hash_cptr tapleaf{};
             script::cptr script;
             chunk_cptrs_ptr stack;
+            std::optional<taproot::commitment> commitment{};
             if ((ec = input.witness().extract_taproot(tapleaf, script, stack,
-                prevout)))
+                prevout, is_null(batch) ? nullptr : &commitment)))
                 return ec;
 
-            interpreter program(tx, it, script, flags, version, stack, tapleaf);
+            // Commitment failure is terminal, so it is deferred to the batch.
+            if (commitment.has_value())
+                batch->defer(std::move(commitment.value()),
+                    error::invalid_commitment);
+
+            interpreter program(tx, it, script, flags, version, stack, tapleaf,
+                batch);
 
             if ((ec = program.run()))
             {
@@ -53,7 +53,7 @@ run() NOEXCEPT
 
         if (state::if_(op))
         {
-            if (const auto ec = run_op(it))
+            if (const auto ec = trace_op(it))
                 return ec;
 
             if (state::is_stack_overflow())
@@ -67,6 +67,28 @@ run() NOEXCEPT
     return error::script_success;
 }
 
+// Operation tracing.
+// ----------------------------------------------------------------------------
+
+// protected
+TEMPLATE
+INLINE error::op_error_t CLASS::
+trace_op(const op_iterator& op) NOEXCEPT
+{
+    if constexpr (Trace::enabled)
+    {
+        const auto start = Trace::clock::now();
+        const auto ec = run_op(op);
+        Trace::record(op->code(), Trace::clock::now() - start,
+            state::stack_size());
+        return ec;
+    }
+    else
+    {
+        return run_op(op);
+    }
+}
+
 // Operation disatch.
 // ----------------------------------------------------------------------------
 // It is expected that the compiler will produce a very efficient jump table.
@@ -353,7 +375,7 @@ run_op(const op_iterator& op) NOEXCEPT
         case opcode::checksig:
             return op_check_sig();
         case opcode::checksigverify:
-            return op_check_sig_verify();
+            return op_check_sig_verify(error::op_check_sig_verify5);
         case opcode::checkmultisig:
             return op_check_multisig();
         case opcode::checkmultisigverify:
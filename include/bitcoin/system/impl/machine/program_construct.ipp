@@ -108,6 +108,7 @@ program(const transaction& tx, const input_iterator& input,
 // Taproot script run (witness-initialized stack).
 // Same as segwit but with tapleaf, budget, and unstripped bip342 flag.
 // Sigop budget is 50 plus size of prefixed serialized witness [bip342].
+// This is the input witness, not the stack (without script/control/annex).
 // Budget is initialized add1(50) to make it zero-based, avoiding signed type.
 // This program is never used to construct another, so masked flags_ never mix.
 TEMPLATE
@@ -115,7 +116,7 @@ inline CLASS::
 program(const transaction& tx, const input_iterator& input,
     const script::cptr& script, uint32_t active_flags,
     script_version version, const chunk_cptrs_ptr& witness,
-    const hash_cptr& tapleaf) NOEXCEPT
+    const hash_cptr& tapleaf, signature_batch* batch) NOEXCEPT
   : transaction_(tx),
     input_(input),
     script_(script),
@@ -124,10 +125,11 @@ program(const transaction& tx, const input_iterator& input,
     version_(version),
     witness_(witness),
     tapleaf_(tapleaf),
+    batch_(batch),
     primary_(projection<Stack>(*witness)),
     budget_(ceilinged_add(
         add1(chain::signature_cost),
-        chain::witness::serialized_size(*witness_, true)))
+        (*input)->witness().serialized_size(true)))
 {
     script_->clear_offset();
 }
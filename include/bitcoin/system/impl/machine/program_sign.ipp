@@ -218,6 +218,33 @@ signature_hash(hash_digest& out, const script& subscript,
         tapleaf_, version_, sighash_flags, flags_);
 }
 
+// Schnorr signature verification.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+INLINE bool CLASS::
+is_key_path() const NOEXCEPT
+{
+    // Tapscript always has a tapleaf, key path and unencumbered do not.
+    return is_enabled(flags::bip342_rule) && !tapleaf_;
+}
+
+// Deferral is only valid when failure would terminate script evaluation, as
+// evaluation proceeds as if the signature is valid. Deferred failures must be
+// resolved by the batch owner before the connection result is accepted.
+TEMPLATE
+INLINE bool CLASS::
+verify_schnorr(const data_chunk& key, const hash_digest& hash,
+    const ec_signature& signature, const code& terminal) const NOEXCEPT
+{
+    if (is_null(batch_) || !terminal || key.size() != ec_xonly_size)
+        return schnorr::verify_signature(key, hash, signature);
+
+    const auto& point = unsafe_array_cast<uint8_t, ec_xonly_size>(key.data());
+    batch_->defer(point, hash, signature, terminal);
+    return true;
+}
+
 // Multisig signature hash caching.
 // ----------------------------------------------------------------------------
 
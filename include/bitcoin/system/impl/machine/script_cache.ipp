@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_SCRIPT_CACHE_IPP
+#define LIBBITCOIN_SYSTEM_MACHINE_SCRIPT_CACHE_IPP
+
+#include <atomic>
+#include <mutex>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+inline script_cache::
+script_cache(size_t entries, const hash_digest& salt) NOEXCEPT
+  : salt_(salt),
+    sets_(std::max(one, ceilinged_divide(entries, ways))),
+    slots_(sets_ * ways),
+    shards_{}
+{
+}
+
+inline bool script_cache::
+exists(const hash_digest& witness_hash, uint32_t index,
+    uint32_t flags) const NOEXCEPT
+{
+    const auto key = to_key(witness_hash, index, flags);
+    return contains(to_set(key), key);
+}
+
+inline void script_cache::
+store(const hash_digest& witness_hash, uint32_t index,
+    uint32_t flags) NOEXCEPT
+{
+    const auto key = to_key(witness_hash, index, flags);
+    const auto set = to_set(key);
+    auto& shard = shards_[set % shards];
+    std::lock_guard lock(shard.mutex);
+
+    if (contains(set, key))
+        return;
+
+    // Use an empty slot in the set if one exists, otherwise evict.
+    const auto first = set * ways;
+    for (auto way = first; way < first + ways; ++way)
+    {
+        if (read(slots_[way]) == key_t{})
+        {
+            write(slots_[way], key);
+            return;
+        }
+    }
+
+    write(slots_[first + (shard.cursor++ % ways)], key);
+}
+
+INLINE size_t script_cache::
+capacity() const NOEXCEPT
+{
+    return slots_.size();
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// The salted hash is never zero (empty slot) in practice.
+inline script_cache::key_t script_cache::
+to_key(const hash_digest& witness_hash, uint32_t index,
+    uint32_t flags) const NOEXCEPT
+{
+    const auto digest = sha256_hash(splice(salt_, witness_hash,
+        splice(to_little_endian(index), to_little_endian(flags))));
+
+    return array_cast<uint64_t>(digest);
+}
+
+inline size_t script_cache::
+to_set(const key_t& key) const NOEXCEPT
+{
+    return possible_narrow_cast<size_t>(key.front() % sets_);
+}
+
+// Lock free, retries while the slot is being written.
+inline script_cache::key_t script_cache::
+read(const slot& slot) NOEXCEPT
+{
+    key_t key{};
+    uint32_t before{}, after{};
+
+    do
+    {
+        before = slot.sequence.load(std::memory_order_acquire);
+        for (size_t word = 0; word < key.size(); ++word)
+            key[word] = slot.key[word].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = slot.sequence.load(std::memory_order_relaxed);
+    } while (is_odd(before) || before != after);
+
+    return key;
+}
+
+// Caller must hold the shard lock (single writer).
+inline void script_cache::
+write(slot& slot, const key_t& key) NOEXCEPT
+{
+    const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(add1(sequence), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t word = 0; word < key.size(); ++word)
+        slot.key[word].store(key[word], std::memory_order_relaxed);
+
+    slot.sequence.store(sequence + two, std::memory_order_release);
+}
+
+inline bool script_cache::
+contains(size_t set, const key_t& key) const NOEXCEPT
+{
+    const auto first = set * ways;
+    for (auto way = first; way < first + ways; ++way)
+        if (read(slots_[way]) == key)
+            return true;
+
+    return false;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
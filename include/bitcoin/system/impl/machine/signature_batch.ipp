@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_SIGNATURE_BATCH_IPP
+#define LIBBITCOIN_SYSTEM_MACHINE_SIGNATURE_BATCH_IPP
+
+#include <algorithm>
+#include <bitcoin/system/chain/taproot.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+INLINE signature_batch::
+signature_batch() NOEXCEPT
+  : verifications_{}, commitments_{}, failures_{}, signatures_{}, commits_{}
+{
+}
+
+inline void signature_batch::
+defer(const ec_xonly& point, const hash_digest& hash,
+    const ec_signature& signature, const code& failure) NOEXCEPT
+{
+    signatures_.push_back(failures_.size());
+    verifications_.push_back({ point, hash, signature });
+    failures_.push_back(failure);
+}
+
+inline void signature_batch::
+defer(chain::taproot::commitment&& commitment, const code& failure) NOEXCEPT
+{
+    commits_.push_back(failures_.size());
+    commitments_.push_back(std::move(commitment));
+    failures_.push_back(failure);
+}
+
+inline code signature_batch::
+verify(const code& ec) const NOEXCEPT
+{
+    auto first = failures_.size();
+
+    const auto signature = schnorr::verify_signatures(verifications_);
+    if (signature < signatures_.size())
+        first = signatures_.at(signature);
+
+    const auto commit = commitments_.empty() ? zero :
+        chain::taproot::verify_commits(commitments_);
+    if (commit < commits_.size())
+        first = std::min(first, commits_.at(commit));
+
+    return first < failures_.size() ? failures_.at(first) : ec;
+}
+
+INLINE size_t signature_batch::
+size() const NOEXCEPT
+{
+    return failures_.size();
+}
+
+BC_POP_WARNING()
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -32,14 +32,39 @@ namespace machine {
 TEMPLATE
 INLINE CLASS::
 stack() NOEXCEPT
-  : container_{}, tether_{}
+  : arena_(make_arena()),
+    container_(get_allocator()),
+    tether_(get_arena())
 {
+    if constexpr (flat_)
+    {
+        container_.reserve(flat_reserve);
+        tether_.reserve(flat_tether);
+    }
 }
 
+// A flat stack container is moved (copied) into the arena.
 TEMPLATE
 INLINE CLASS::
 stack(Container&& container) NOEXCEPT
-  : container_(std::move(container)), tether_{}
+  : arena_(make_arena()),
+    container_(std::move(container), get_allocator()),
+    tether_(get_arena())
+{
+    if constexpr (flat_)
+    {
+        container_.reserve(flat_reserve);
+        tether_.reserve(flat_tether);
+    }
+}
+
+// A flat stack copy shares the arena (and thereby the tethered chunks).
+TEMPLATE
+INLINE CLASS::
+stack(const stack& other) NOEXCEPT
+  : arena_(other.arena_),
+    container_(other.container_, get_allocator()),
+    tether_(other.tether_, get_arena())
 {
 }
 
@@ -92,7 +117,7 @@ push(data_chunk&& value) NOEXCEPT
 {
     // The following script operations will ALWAYS tether chunks, as the result
     // of a computed hash is *pushed* to the weak pointer (xptr) variant stack.
-    // make_external attaches value to tether returns weak pointer (chunk_xptr).
+    // tether_chunk attaches value to tether, returns weak pointer (chunk_xptr).
     //
     // op_ripemd160         (1)
     // op_sha1              (1)
@@ -100,7 +125,7 @@ push(data_chunk&& value) NOEXCEPT
     // op_hash160           (1)
     // op_hash256           (1)
 
-    container_.push_back(make_external(std::move(value), tether_));
+    container_.push_back(tether_chunk(std::move(value)));
 }
 
 TEMPLATE
@@ -200,6 +225,64 @@ peek_signed5(int64_t& value) const NOEXCEPT
     return peek_signed<5>(value);
 }
 
+// Flat stack arena (private).
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+inline std::shared_ptr<typename CLASS::flat_arena> CLASS::
+make_arena() NOEXCEPT
+{
+    if constexpr (flat_)
+        return std::make_shared<flat_arena>();
+    else
+        return {};
+}
+
+TEMPLATE
+inline arena* CLASS::
+get_arena() const NOEXCEPT
+{
+    if constexpr (flat_)
+        return arena_.get();
+    else
+        return default_arena::get();
+}
+
+TEMPLATE
+inline typename Container::allocator_type CLASS::
+get_allocator() const NOEXCEPT
+{
+    if constexpr (flat_)
+        return { get_arena() };
+    else
+        return {};
+}
+
+// Attaches value to tether_ and returns weak pointer (chunk_xptr).
+// A flat stack places a small chunk (up to the largest direct push) inline in
+// its arena, with its control block and bytes (the arena allocator propagates
+// to the chunk). A larger chunk buffer is moved, not copied, to the tether.
+TEMPLATE
+inline chunk_xptr CLASS::
+tether_chunk(data_chunk&& value) const NOEXCEPT
+{
+    if constexpr (flat_)
+    {
+        if (value.size() <= flat_inline)
+            tether_.push_back(std::allocate_shared<data_chunk>(
+                allocator<data_chunk>{ get_arena() }, value.begin(),
+                value.end()));
+        else
+            tether_.push_back(std::make_shared<data_chunk>(std::move(value)));
+
+        return { tether_.back().get() };
+    }
+    else
+    {
+        return make_external(std::move(value), tether_);
+    }
+}
+
 } // namespace machine
 } // namespace system
 } // namespace libbitcoin
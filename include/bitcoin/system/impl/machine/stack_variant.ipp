@@ -200,8 +200,8 @@ peek_chunk() const NOEXCEPT
 
     // The following script operations will ONLY tether chunks in case where
     // the *popped* element was originally bool/int64_t but required as chunk.
-    // This is never the case in standard scripts. make_external attaches moved
-    // chunk to tether and returns weak pointer (chunk_xptr).
+    // This is never the case in standard scripts. tether_chunk attaches moved
+    // chunk to tether_ and returns weak pointer (chunk_xptr).
     //
     // op_ripemd160         (0..1)
     // op_sha1              (0..1)
@@ -218,12 +218,12 @@ peek_chunk() const NOEXCEPT
         [&](bool vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = make_external(chunk::from_bool(vary), tether_);
+            value = tether_chunk(chunk::from_bool(vary));
         },
         [&](int64_t vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = make_external(chunk::from_integer(vary), tether_);
+            value = tether_chunk(chunk::from_integer(vary));
         },
         [&](const chunk_xptr& vary) NOEXCEPT
         {
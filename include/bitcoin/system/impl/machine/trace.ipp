@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_TRACE_IPP
+#define LIBBITCOIN_SYSTEM_MACHINE_TRACE_IPP
+
+#include <atomic>
+#include <chrono>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Classification.
+// ----------------------------------------------------------------------------
+
+inline spend_pattern op_trace::classify(const chain::input& input) NOEXCEPT
+{
+    using namespace chain;
+    if (!input.prevout)
+        return spend_pattern::other;
+
+    const auto& ops = input.prevout->script().ops();
+
+    if (script::is_pay_key_hash_pattern(ops))
+        return spend_pattern::p2pkh;
+
+    if (script::is_pay_script_hash_pattern(ops))
+        return spend_pattern::p2sh;
+
+    if (script::is_pay_witness_key_hash_pattern(ops))
+        return spend_pattern::p2wpkh;
+
+    if (script::is_pay_witness_script_hash_pattern(ops))
+        return spend_pattern::p2wsh;
+
+    if (script::is_pay_witness_taproot_pattern(ops))
+    {
+        // Key path spend is a lone signature, excluding any annex [bip341].
+        const auto& stack = input.witness().stack();
+        const auto elements = annex::is_annex_pattern(stack) ? two : one;
+        return stack.size() == elements ? spend_pattern::p2tr_keypath :
+            spend_pattern::p2tr_scriptpath;
+    }
+
+    return spend_pattern::other;
+}
+
+// Recording.
+// ----------------------------------------------------------------------------
+
+inline void op_trace::record(chain::opcode code, clock::duration elapsed,
+    size_t depth) NOEXCEPT
+{
+    add(opcode_table()[static_cast<uint8_t>(code)], elapsed, depth);
+}
+
+inline void op_trace::record(spend_pattern pattern,
+    clock::duration elapsed) NOEXCEPT
+{
+    add(pattern_table()[static_cast<uint8_t>(pattern)], elapsed, zero);
+}
+
+// Snapshots.
+// ----------------------------------------------------------------------------
+
+inline op_trace::opcode_counters op_trace::opcodes() NOEXCEPT
+{
+    return snapshot(opcode_table());
+}
+
+inline op_trace::pattern_counters op_trace::spends() NOEXCEPT
+{
+    return snapshot(pattern_table());
+}
+
+inline void op_trace::reset() NOEXCEPT
+{
+    const auto clear = [](auto& table) NOEXCEPT
+    {
+        for (auto& counter: table)
+        {
+            counter.executions.store(0, std::memory_order_relaxed);
+            counter.nanoseconds.store(0, std::memory_order_relaxed);
+            counter.depth.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    clear(opcode_table());
+    clear(pattern_table());
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+inline op_trace::atomic_counters<op_trace::opcode_count>&
+op_trace::opcode_table() NOEXCEPT
+{
+    static atomic_counters<opcode_count> table{};
+    return table;
+}
+
+inline op_trace::atomic_counters<op_trace::pattern_count>&
+op_trace::pattern_table() NOEXCEPT
+{
+    static atomic_counters<pattern_count> table{};
+    return table;
+}
+
+inline void op_trace::add(atomic_counter& counter, clock::duration elapsed,
+    size_t depth) NOEXCEPT
+{
+    using namespace std::chrono;
+    const auto nanoseconds = duration_cast<std::chrono::nanoseconds>(elapsed);
+    counter.executions.fetch_add(1, std::memory_order_relaxed);
+    counter.nanoseconds.fetch_add(
+        possible_sign_cast<uint64_t>(nanoseconds.count()),
+        std::memory_order_relaxed);
+
+    // Maximum depth.
+    auto prior = counter.depth.load(std::memory_order_relaxed);
+    while (depth > prior && !counter.depth.compare_exchange_weak(prior, depth,
+        std::memory_order_relaxed));
+}
+
+template <size_t Size>
+inline std_array<op_trace::counter, Size> op_trace::snapshot(
+    const atomic_counters<Size>& table) NOEXCEPT
+{
+    std_array<counter, Size> out{};
+    for (size_t index = 0; index < Size; ++index)
+    {
+        out[index].executions = table[index].executions.load(
+            std::memory_order_relaxed);
+        out[index].nanoseconds = table[index].nanoseconds.load(
+            std::memory_order_relaxed);
+        out[index].depth = table[index].depth.load(
+            std::memory_order_relaxed);
+    }
+
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
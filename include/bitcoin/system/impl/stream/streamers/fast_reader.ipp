@@ -0,0 +1,400 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_READER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_READER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Allowed here for low level performance benefit.
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_UNSAFE_COPY_N)
+
+// Suppress allocator may throw inside NOEXCEPT.
+// The intended behavior in this case is program abort.
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// static
+inline fast_reader::memory_arena
+fast_reader::default_arena() NOEXCEPT
+{
+    return bc::default_arena::get();
+}
+
+// constructors
+// ----------------------------------------------------------------------------
+
+inline fast_reader::fast_reader(const data_slice& source) NOEXCEPT
+  : fast_reader(source, default_arena())
+{
+}
+
+inline fast_reader::fast_reader(const data_slice& source,
+    const memory_arena& arena) NOEXCEPT
+  : begin_(source.data()),
+    position_(begin_),
+    end_(begin_ + source.size()),
+    valid_(true),
+    allocator_(arena)
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline Integer fast_reader::read_big_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    read_bytes(std::next(bytes.data(), sizeof(Integer) - Size), Size);
+    return native_from_big_end(value);
+}
+
+inline uint16_t fast_reader::read_2_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint16_t>();
+}
+
+inline uint32_t fast_reader::read_4_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint32_t>();
+}
+
+inline uint64_t fast_reader::read_8_bytes_big_endian() NOEXCEPT
+{
+    return read_big_endian<uint64_t>();
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline Integer fast_reader::read_little_endian() NOEXCEPT
+{
+    Integer value{};
+    auto& bytes = byte_cast(value);
+    read_bytes(bytes.data(), Size);
+    return native_from_little_end(value);
+}
+
+inline uint16_t fast_reader::read_2_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint16_t>();
+}
+
+inline uint32_t fast_reader::read_4_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint32_t>();
+}
+
+inline uint64_t fast_reader::read_8_bytes_little_endian() NOEXCEPT
+{
+    return read_little_endian<uint64_t>();
+}
+
+inline uint64_t fast_reader::read_variable() NOEXCEPT
+{
+    switch (const auto value = read_byte())
+    {
+        case varint_eight_bytes:
+            return read_8_bytes_little_endian();
+        case varint_four_bytes:
+            return read_4_bytes_little_endian();
+        case varint_two_bytes:
+            return read_2_bytes_little_endian();
+        default:
+            return value;
+    }
+}
+
+inline size_t fast_reader::read_size(size_t limit) NOEXCEPT
+{
+    const auto size = read_variable();
+
+    // Return zero allows follow-on use before testing reader state.
+    if (size > limit)
+    {
+        invalidate();
+        return zero;
+    }
+
+    return possible_narrow_cast<size_t>(size);
+}
+
+inline code fast_reader::read_error_code() NOEXCEPT
+{
+    const auto value = read_little_endian<uint32_t>();
+    return code(static_cast<error::error_t>(value));
+}
+
+inline uint8_t fast_reader::peek_byte() NOEXCEPT
+{
+    if (is_exhausted())
+    {
+        invalidate();
+        return pad();
+    }
+
+    return *position_;
+}
+
+inline uint8_t fast_reader::read_byte() NOEXCEPT
+{
+    const auto data = advance(one);
+    return is_null(data) ? pad() : *data;
+}
+
+// byte arrays
+// ----------------------------------------------------------------------------
+
+template <size_t Size>
+inline data_array<Size> fast_reader::read_forward() NOEXCEPT
+{
+    // Truncated bytes are populated with 0x00.
+    data_array<Size> out{};
+    read_bytes(out.data(), Size);
+    return out;
+}
+
+template <size_t Size>
+inline data_array<Size> fast_reader::read_reverse() NOEXCEPT
+{
+    return system::reverse(read_forward<Size>());
+}
+
+inline mini_hash fast_reader::read_mini_hash() NOEXCEPT
+{
+    return read_forward<mini_hash_size>();
+}
+
+inline short_hash fast_reader::read_short_hash() NOEXCEPT
+{
+    return read_forward<short_hash_size>();
+}
+
+inline hash_digest fast_reader::read_hash() NOEXCEPT
+{
+    return read_forward<hash_size>();
+}
+
+inline long_hash fast_reader::read_long_hash() NOEXCEPT
+{
+    return read_forward<long_hash_size>();
+}
+
+// byte vectors
+// ----------------------------------------------------------------------------
+
+inline data_chunk fast_reader::read_bytes() NOEXCEPT
+{
+    return read_bytes(remaining());
+}
+
+inline data_chunk* fast_reader::read_bytes_raw() NOEXCEPT
+{
+    return read_bytes_raw(remaining());
+}
+
+inline data_chunk fast_reader::read_bytes(size_t size) NOEXCEPT
+{
+    // An invalid read does not allocate.
+    const auto data = advance(size);
+    if (is_null(data))
+        return {};
+
+    return data_chunk(data, std::next(data, size));
+}
+
+inline data_chunk* fast_reader::read_bytes_raw(size_t size) NOEXCEPT
+{
+    // This allows caller to read an invalid stream without allocation.
+    if (!valid_)
+        return nullptr;
+
+    const auto data = advance(size);
+    if (is_null(data))
+        return nullptr;
+
+    // The chunk is constructed from the buffer, avoiding a byte fill.
+    const auto raw = allocator_.new_object<data_chunk>(data,
+        std::next(data, size));
+
+    if (is_null(raw))
+        invalidate();
+
+    return raw;
+}
+
+inline void fast_reader::read_bytes(uint8_t* buffer, size_t size) NOEXCEPT
+{
+    // Invalid reads do not write to buffer.
+    const auto data = advance(size);
+    if (!is_null(data))
+        std::copy_n(data, size, buffer);
+}
+
+inline data_slice fast_reader::read_slice(size_t size) NOEXCEPT
+{
+    // The view is of the source buffer, so its lifetime bounds the slice.
+    const auto data = advance(size);
+    if (is_null(data))
+        return {};
+
+    return { data, std::next(data, size) };
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+inline void fast_reader::skip_byte() NOEXCEPT
+{
+    advance(one);
+}
+
+inline void fast_reader::skip_bytes(size_t size) NOEXCEPT
+{
+    advance(size);
+}
+
+inline void fast_reader::skip_variable() NOEXCEPT
+{
+    switch (read_byte())
+    {
+        case varint_eight_bytes:
+            advance(8);
+            return;
+        case varint_four_bytes:
+            advance(4);
+            return;
+        case varint_two_bytes:
+            advance(2);
+            return;
+        default:
+            return;
+    }
+}
+
+inline void fast_reader::rewind_byte() NOEXCEPT
+{
+    rewind_bytes(one);
+}
+
+inline void fast_reader::rewind_bytes(size_t size) NOEXCEPT
+{
+    if (!valid_ || size > get_read_position())
+    {
+        invalidate();
+        return;
+    }
+
+    position_ -= size;
+}
+
+inline bool fast_reader::is_exhausted() const NOEXCEPT
+{
+    // True if invalid or if no bytes remain in the buffer.
+    return !valid_ || position_ == end_;
+}
+
+inline size_t fast_reader::get_read_position() const NOEXCEPT
+{
+    return possible_narrow_and_sign_cast<size_t>(position_ - begin_);
+}
+
+inline void fast_reader::set_position(size_t absolute) NOEXCEPT
+{
+    // Clear a presumed error state following a read overflow.
+    valid_ = true;
+
+    if (absolute > possible_narrow_and_sign_cast<size_t>(end_ - begin_))
+    {
+        invalidate();
+        return;
+    }
+
+    position_ = begin_ + absolute;
+}
+
+inline void fast_reader::invalidate() NOEXCEPT
+{
+    valid_ = false;
+}
+
+inline fast_reader::memory_arena fast_reader::get_arena() const NOEXCEPT
+{
+    return allocator_.resource();
+}
+
+inline byte_allocator& fast_reader::get_allocator() const NOEXCEPT
+{
+    return allocator_;
+}
+
+inline fast_reader::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+inline bool fast_reader::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+inline size_t fast_reader::remaining() const NOEXCEPT
+{
+    return valid_ ? possible_narrow_and_sign_cast<size_t>(end_ - position_) :
+        zero;
+}
+
+// The bounds check of every field read, returns nullptr (invalid) on overflow.
+inline const uint8_t* fast_reader::advance(size_t size) NOEXCEPT
+{
+    if (size > remaining())
+    {
+        invalidate();
+        return nullptr;
+    }
+
+    const auto data = position_;
+    position_ += size;
+    return data;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
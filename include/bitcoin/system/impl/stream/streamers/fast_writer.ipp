@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_WRITER_IPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_WRITER_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Allowed here for low level performance benefit.
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_UNSAFE_COPY_N)
+
+// constructors
+// ----------------------------------------------------------------------------
+
+inline fast_writer::fast_writer(const data_slab& sink) NOEXCEPT
+  : begin_(sink.data()),
+    position_(begin_),
+    end_(begin_ + sink.size()),
+    valid_(true)
+{
+}
+
+// big endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline void fast_writer::write_big_endian(Integer value) NOEXCEPT
+{
+    const auto bytes = byte_cast(native_to_big_end(value));
+    write_bytes(std::next(bytes.data(), sizeof(Integer) - Size), Size);
+}
+
+inline void fast_writer::write_2_bytes_big_endian(uint16_t value) NOEXCEPT
+{
+    write_big_endian<uint16_t>(value);
+}
+
+inline void fast_writer::write_4_bytes_big_endian(uint32_t value) NOEXCEPT
+{
+    write_big_endian<uint32_t>(value);
+}
+
+inline void fast_writer::write_8_bytes_big_endian(uint64_t value) NOEXCEPT
+{
+    write_big_endian<uint64_t>(value);
+}
+
+// little endian
+// ----------------------------------------------------------------------------
+
+template <typename Integer, size_t Size,
+    if_integer<Integer>, if_not_greater<Size, sizeof(Integer)>>
+inline void fast_writer::write_little_endian(Integer value) NOEXCEPT
+{
+    const auto bytes = byte_cast(native_to_little_end(value));
+    write_bytes(bytes.data(), Size);
+}
+
+inline void fast_writer::write_2_bytes_little_endian(uint16_t value) NOEXCEPT
+{
+    write_little_endian<uint16_t>(value);
+}
+
+inline void fast_writer::write_4_bytes_little_endian(uint32_t value) NOEXCEPT
+{
+    write_little_endian<uint32_t>(value);
+}
+
+inline void fast_writer::write_8_bytes_little_endian(uint64_t value) NOEXCEPT
+{
+    write_little_endian<uint64_t>(value);
+}
+
+// Normal consensus form.
+// There is exactly one representation for any number in the domain.
+inline void fast_writer::write_variable(uint64_t value) NOEXCEPT
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(narrow_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_2_bytes_little_endian(narrow_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_little_endian(narrow_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_little_endian(value);
+    }
+}
+
+// Normal client-server form.
+inline void fast_writer::write_error_code(const code& ec) NOEXCEPT
+{
+    write_4_bytes_little_endian(sign_cast<uint32_t>(ec.value()));
+}
+
+inline void fast_writer::write_byte(uint8_t value) NOEXCEPT
+{
+    const auto data = advance(one);
+    if (!is_null(data))
+        *data = value;
+}
+
+// bytes
+// ----------------------------------------------------------------------------
+
+inline void fast_writer::write_bytes(const data_slice& data) NOEXCEPT
+{
+    write_bytes(data.data(), data.size());
+}
+
+inline void fast_writer::write_bytes(const uint8_t* data, size_t size) NOEXCEPT
+{
+    // Invalid writes do not write to buffer.
+    const auto to = advance(size);
+    if (!is_null(to))
+        std::copy_n(data, size, to);
+}
+
+// control
+// ----------------------------------------------------------------------------
+
+inline void fast_writer::skip_bytes(size_t size) NOEXCEPT
+{
+    advance(size);
+}
+
+inline bool fast_writer::is_exhausted() const NOEXCEPT
+{
+    // True if invalid or if no bytes remain in the buffer.
+    return !valid_ || position_ == end_;
+}
+
+inline size_t fast_writer::get_write_position() const NOEXCEPT
+{
+    return possible_narrow_and_sign_cast<size_t>(position_ - begin_);
+}
+
+inline void fast_writer::invalidate() NOEXCEPT
+{
+    valid_ = false;
+}
+
+inline fast_writer::operator bool() const NOEXCEPT
+{
+    return valid_;
+}
+
+inline bool fast_writer::operator!() const NOEXCEPT
+{
+    return !valid_;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+inline size_t fast_writer::remaining() const NOEXCEPT
+{
+    return valid_ ? possible_narrow_and_sign_cast<size_t>(end_ - position_) :
+        zero;
+}
+
+// This is the only bounds check, returns nullptr (invalid) on overflow.
+inline uint8_t* fast_writer::advance(size_t size) NOEXCEPT
+{
+    if (size > remaining())
+    {
+        invalidate();
+        return nullptr;
+    }
+
+    const auto data = position_;
+    position_ += size;
+    return data;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
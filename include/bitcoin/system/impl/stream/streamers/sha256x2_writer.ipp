@@ -42,6 +42,13 @@ sha256x2_writer<OStream>::sha256x2_writer(OStream& sink) NOEXCEPT
 {
 }
 
+template <typename OStream>
+sha256x2_writer<OStream>::sha256x2_writer(OStream& sink,
+    const accumulator<sha256>& context) NOEXCEPT
+  : base(sink), context_(context)
+{
+}
+
 template <typename OStream>
 sha256x2_writer<OStream>::~sha256x2_writer() NOEXCEPT
 {
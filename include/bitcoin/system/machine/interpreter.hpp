@@ -24,13 +24,15 @@
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/machine/program.hpp>
+#include <bitcoin/system/machine/trace.hpp>
 
 namespace libbitcoin {
 namespace system {
 namespace machine {
 
 /// Class to isolate operation iteration, dispatch, and handlers from state.
-template <typename Stack>
+/// Trace is a compile time tracing policy (see trace.hpp), no_trace is free.
+template <typename Stack, typename Trace = no_trace>
 class interpreter
   : public program<Stack>
 {
@@ -55,21 +57,40 @@ public:
     static code connect(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
 
+    /// Connect tx.input[*].script to tx.input[*].prevout.script, deferring
+    /// terminal schnorr signature and taproot commitment verifications to
+    /// batch (see batch.verify).
+    static code connect(const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it,
+        signature_batch& batch) NOEXCEPT;
+
 protected:
     using flags = chain::flags;
     using opcode = chain::opcode;
     using operation = chain::operation;
     using op_error_t = error::op_error_t;
 
+    /// Input script handler.
+    static code connect_input(const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it,
+        signature_batch* batch) NOEXCEPT;
+
     /// Embedded script handler.
     static code connect_embedded(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it,
-        interpreter& in_program) NOEXCEPT;
+        interpreter& in_program, signature_batch* batch) NOEXCEPT;
 
     /// Witnessed script handler.
     static code connect_witness(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it,
-        const chain::script& prevout, bool embedded) NOEXCEPT;
+        const chain::script& prevout, bool embedded,
+        signature_batch* batch) NOEXCEPT;
+
+    /// Traced input script and operation dispatch (untraced if disabled).
+    static code trace_input(const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it,
+        signature_batch* batch) NOEXCEPT;
+    INLINE op_error_t trace_op(const op_iterator& op) NOEXCEPT;
 
     /// Operation disatch.
     op_error_t run_op(const op_iterator& op) NOEXCEPT;
@@ -156,7 +177,7 @@ protected:
     inline op_error_t op_hash256() NOEXCEPT;
     inline op_error_t op_codeseparator(const op_iterator& op) NOEXCEPT;
     inline op_error_t op_check_sig() NOEXCEPT;
-    inline op_error_t op_check_sig_verify() NOEXCEPT;
+    inline op_error_t op_check_sig_verify(const code& terminal) NOEXCEPT;
     inline op_error_t op_check_multisig_verify() NOEXCEPT;
     inline op_error_t op_check_multisig() NOEXCEPT;
     inline op_error_t op_check_locktime_verify() const NOEXCEPT;
@@ -168,8 +189,8 @@ protected:
 } // namespace system
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename Stack>
-#define CLASS interpreter<Stack>
+#define TEMPLATE template <typename Stack, typename Trace>
+#define CLASS interpreter<Stack, Trace>
 
 #include <bitcoin/system/impl/machine/interpreter.ipp>
 #include <bitcoin/system/impl/machine/interpreter_connect.ipp>
@@ -25,6 +25,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/signature_batch.hpp>
 #include <bitcoin/system/machine/stack.hpp>
 
 namespace libbitcoin {
@@ -60,11 +61,12 @@ public:
         uint32_t active_flags, script_version version,
         const chunk_cptrs_ptr& stack) NOEXCEPT;
 
-    /// Witness v1 (tapscript) script.
+    /// Witness v1 (tapscript) script, optional schnorr verification batch.
     inline program(const transaction& transaction,
         const input_iterator& input, const script::cptr& script,
         uint32_t active_flags, script_version version,
-        const chunk_cptrs_ptr& stack, const hash_cptr& tapleaf) NOEXCEPT;
+        const chunk_cptrs_ptr& stack, const hash_cptr& tapleaf,
+        signature_batch* batch=nullptr) NOEXCEPT;
 
     /// Program result.
     inline bool is_true(bool clean) const NOEXCEPT;
@@ -187,6 +189,16 @@ protected:
     INLINE bool signature_hash(hash_digest& out, const script& subscript,
         uint8_t sighash_flags) const NOEXCEPT;
 
+    /// Schnorr signature verification.
+    /// -----------------------------------------------------------------------
+
+    /// Taproot key path spend (tapscript is not executed).
+    INLINE bool is_key_path() const NOEXCEPT;
+
+    /// Verify, or defer to batch (if set) when failure is terminal (non-zero).
+    INLINE bool verify_schnorr(const data_chunk& key, const hash_digest& hash,
+        const ec_signature& signature, const code& terminal) const NOEXCEPT;
+
     /// Multisig signature hash caching.
     /// -----------------------------------------------------------------------
     INLINE void initialize_cache() NOEXCEPT;
@@ -228,6 +240,7 @@ private:
     const script_version version_;
     const chunk_cptrs_ptr witness_{};
     const hash_cptr tapleaf_{};
+    signature_batch* const batch_{};
 
     // Caches.
     multisig_cache cache_{};
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_SCRIPT_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_SCRIPT_CACHE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Bounded set of successful input script executions, keyed by a salted hash
+/// of the transaction witness hash, input index and active flags. The salt
+/// should be secret (random), precluding construction of colliding entries.
+/// Thread safe, reads are lock free and writes are locked by shard. When a
+/// set is full a new entry evicts an existing entry (round robin).
+class script_cache
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(script_cache);
+
+    /// Entries are rounded up to a multiple of set size (ways).
+    inline script_cache(size_t entries, const hash_digest& salt) NOEXCEPT;
+
+    /// True if successful execution of the input script has been stored.
+    inline bool exists(const hash_digest& witness_hash, uint32_t index,
+        uint32_t flags) const NOEXCEPT;
+
+    /// Store successful execution of the input script.
+    inline void store(const hash_digest& witness_hash, uint32_t index,
+        uint32_t flags) NOEXCEPT;
+
+    /// Maximum number of entries.
+    INLINE size_t capacity() const NOEXCEPT;
+
+private:
+    static constexpr size_t ways = 4;
+    static constexpr size_t shards = 64;
+    using key_t = std_array<uint64_t, array_count<hash_digest> / sizeof(uint64_t)>;
+
+    // Key words are atomic (relaxed) and guarded by the sequence (seqlock).
+    struct slot
+    {
+        std::atomic<uint32_t> sequence{};
+        std_array<std::atomic<uint64_t>, std::tuple_size_v<key_t>> key{};
+    };
+
+    // Writers are serialized by shard, with the shard eviction cursor.
+    struct shard
+    {
+        std::mutex mutex{};
+        size_t cursor{};
+    };
+
+    inline key_t to_key(const hash_digest& witness_hash, uint32_t index,
+        uint32_t flags) const NOEXCEPT;
+    inline size_t to_set(const key_t& key) const NOEXCEPT;
+    static inline key_t read(const slot& slot) NOEXCEPT;
+    static inline void write(slot& slot, const key_t& key) NOEXCEPT;
+    inline bool contains(size_t set, const key_t& key) const NOEXCEPT;
+
+    const hash_digest salt_;
+    const size_t sets_;
+    std_vector<slot> slots_;
+    std_array<shard, shards> shards_;
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/machine/script_cache.ipp>
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_SIGNATURE_BATCH_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_SIGNATURE_BATCH_HPP
+
+#include <bitcoin/system/chain/taproot.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Schnorr signature and taproot commitment verifications deferred from
+/// script evaluation, each with the code that its failure would have produced
+/// in place (not thread safe). Only verifications with terminal failure are
+/// deferred, so a deferred failure precedes (in evaluation order) any
+/// subsequent failure.
+class signature_batch
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(signature_batch);
+
+    INLINE signature_batch() NOEXCEPT;
+
+    /// Defer verification (caller proceeds as if valid).
+    inline void defer(const ec_xonly& point, const hash_digest& hash,
+        const ec_signature& signature, const code& failure) NOEXCEPT;
+    inline void defer(chain::taproot::commitment&& commitment,
+        const code& failure) NOEXCEPT;
+
+    /// Verify deferrals, returns the failure code of the first (by deferral
+    /// order) invalid signature or commitment, otherwise the given code.
+    inline code verify(const code& ec) const NOEXCEPT;
+
+    /// Deferral count.
+    INLINE size_t size() const NOEXCEPT;
+
+private:
+    schnorr::verifications verifications_;
+    chain::taproot::commitments commitments_;
+
+    // Failure codes by deferral order, and deferral order of each kind.
+    std_vector<code> failures_;
+    std_vector<size_t> signatures_;
+    std_vector<size_t> commits_;
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/machine/signature_batch.ipp>
+
+#endif
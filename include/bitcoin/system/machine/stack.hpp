@@ -20,6 +20,9 @@
 #define LIBBITCOIN_SYSTEM_MACHINE_STACK_HPP
 
 #include <list>
+#include <memory>
+#include <bitcoin/system/allocator.hpp>
+#include <bitcoin/system/arena.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/machine/number_boolean.hpp>
@@ -38,6 +41,9 @@ typedef std::variant<bool, int64_t, chunk_xptr> stack_variant;
 typedef std::list<stack_variant> linked_stack;
 typedef std::vector<stack_variant> contiguous_stack;
 
+/// Contiguous stack with elements and tethered chunks in a per-stack arena.
+typedef std_vector<stack_variant> flat_stack;
+
 /// Alternate stack requires no stack<T> abstraction.
 typedef std::vector<stack_variant> alternate_stack;
 
@@ -50,7 +56,12 @@ class stack
 {
 public:
     /// Stack is copied in program construct.
-    DEFAULT_COPY_MOVE_DESTRUCT(stack);
+    /// Assignment would release a flat stack arena before its contents.
+    stack(stack&&) NOEXCEPT = default;
+    INLINE stack(const stack& other) NOEXCEPT;
+    stack& operator=(stack&&) NOEXCEPT = delete;
+    stack& operator=(const stack&) NOEXCEPT = delete;
+    virtual ~stack() NOEXCEPT = default;
 
     /// Construct.
     INLINE stack() NOEXCEPT;
@@ -93,9 +104,27 @@ private:
     inline bool peek_signed(Integer& value) const NOEXCEPT;
 
     static constexpr auto linked_ = is_same_type<Container, linked_stack>;
-    static constexpr auto vector_ = is_same_type<Container, contiguous_stack>;
+    static constexpr auto flat_ = is_same_type<Container, flat_stack>;
+    static constexpr auto vector_ = flat_ ||
+        is_same_type<Container, contiguous_stack>;
     static_assert(linked_ || vector_, "unsupported stack container");
 
+    // Sized to hold common stacks and their tethered chunks in one buffer.
+    static constexpr size_t flat_arena_size = 512;
+    static constexpr size_t flat_reserve = 8;
+    static constexpr size_t flat_tether = 4;
+    static constexpr size_t flat_inline = 75;
+    using flat_arena = inline_arena<flat_arena_size>;
+
+    static inline std::shared_ptr<flat_arena> make_arena() NOEXCEPT;
+    inline arena* get_arena() const NOEXCEPT;
+    inline typename Container::allocator_type get_allocator() const NOEXCEPT;
+    inline chunk_xptr tether_chunk(data_chunk&& value) const NOEXCEPT;
+
+    // Flat stack arena, shared by copies, and outlives all contents below.
+    // A flat stack allocates only its arena (in common scripts), as pushed
+    // data refers to script operations and tethered chunks are in the arena.
+    std::shared_ptr<flat_arena> arena_;
     Container container_;
 
     // Tethering
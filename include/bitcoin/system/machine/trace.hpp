@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_TRACE_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Spend pattern of an input, as classified by its prevout script.
+enum class spend_pattern : uint8_t
+{
+    other,
+    p2pkh,
+    p2sh,
+    p2wpkh,
+    p2wsh,
+    p2tr_keypath,
+    p2tr_scriptpath
+};
+
+/// Interpreter tracing policy (default), compiled away entirely.
+struct no_trace
+{
+    static constexpr bool enabled = false;
+};
+
+/// Interpreter tracing policy, accumulates executions, nanoseconds and
+/// maximum stack depth per opcode, and executions and nanoseconds per spend
+/// pattern (input connect). Counters are process-wide relaxed atomics, so
+/// tracing is thread safe but snapshots are not atomic across counters.
+class op_trace
+{
+public:
+    static constexpr bool enabled = true;
+    static constexpr auto opcode_count = add1(size_t{ max_uint8 });
+    static constexpr auto pattern_count = add1(static_cast<size_t>(
+        spend_pattern::p2tr_scriptpath));
+
+    using clock = std::chrono::steady_clock;
+
+    struct counter
+    {
+        uint64_t executions;
+        uint64_t nanoseconds;
+        size_t depth;
+    };
+
+    using opcode_counters = std_array<counter, opcode_count>;
+    using pattern_counters = std_array<counter, pattern_count>;
+
+    /// Classify the spend of an input (other if prevout not populated).
+    static inline spend_pattern classify(const chain::input& input) NOEXCEPT;
+
+    /// Record one execution (interpreter).
+    static inline void record(chain::opcode code, clock::duration elapsed,
+        size_t depth) NOEXCEPT;
+    static inline void record(spend_pattern pattern,
+        clock::duration elapsed) NOEXCEPT;
+
+    /// Snapshot and reset accumulated counters.
+    static inline opcode_counters opcodes() NOEXCEPT;
+    static inline pattern_counters spends() NOEXCEPT;
+    static inline void reset() NOEXCEPT;
+
+private:
+    struct atomic_counter
+    {
+        std::atomic<uint64_t> executions{};
+        std::atomic<uint64_t> nanoseconds{};
+        std::atomic<size_t> depth{};
+    };
+
+    template <size_t Size>
+    using atomic_counters = std_array<atomic_counter, Size>;
+
+    static inline atomic_counters<opcode_count>& opcode_table() NOEXCEPT;
+    static inline atomic_counters<pattern_count>& pattern_table() NOEXCEPT;
+
+    static inline void add(atomic_counter& counter, clock::duration elapsed,
+        size_t depth) NOEXCEPT;
+    template <size_t Size>
+    static inline std_array<counter, Size> snapshot(
+        const atomic_counters<Size>& table) NOEXCEPT;
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/machine/trace.ipp>
+
+#endif
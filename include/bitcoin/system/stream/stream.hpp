@@ -36,6 +36,8 @@
 #include <bitcoin/system/stream/streamers/byte_flipper.hpp>
 #include <bitcoin/system/stream/streamers/byte_reader.hpp>
 #include <bitcoin/system/stream/streamers/byte_writer.hpp>
+#include <bitcoin/system/stream/streamers/fast_reader.hpp>
+#include <bitcoin/system/stream/streamers/fast_writer.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/byteflipper.hpp>
 #include <bitcoin/system/stream/streamers/interfaces/bitreader.hpp>
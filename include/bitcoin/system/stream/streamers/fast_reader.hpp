@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_READER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_READER_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A final, non-virtual byte reader over a contiguous byte buffer.
+/// This is not a bytereader, its members are resolved (and inlined) at
+/// compile time. It reads the same buffer as byte_reader<stream::in::fast>,
+/// directly, so that each field read is a single bounds comparison and copy.
+/// Bounds are checked per field, as the extent of a serialized object is not
+/// known until its (variable length) fields are read. Bytes are not padded or
+/// partially read on overflow, the reader is just invalidated (and subsequent
+/// reads fail the same comparison), so the caller need only test validity
+/// once per object, not once per field.
+class fast_reader final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(fast_reader);
+    using memory_arena = arena*;
+    static inline memory_arena default_arena() NOEXCEPT;
+
+    /// Constructors.
+    inline fast_reader(const data_slice& source) NOEXCEPT;
+    inline fast_reader(const data_slice& source,
+        const memory_arena& arena) NOEXCEPT;
+
+    /// Integrals.
+    /// -----------------------------------------------------------------------
+
+    /// Read integer, size determined from parameter type.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline Integer read_big_endian() NOEXCEPT;
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline Integer read_little_endian() NOEXCEPT;
+
+    /// Read big endian (explicit specializations of read_big_endian).
+    inline uint16_t read_2_bytes_big_endian() NOEXCEPT;
+    inline uint32_t read_4_bytes_big_endian() NOEXCEPT;
+    inline uint64_t read_8_bytes_big_endian() NOEXCEPT;
+
+    /// Little endian integer readers (specializations of read_little_endian).
+    inline uint16_t read_2_bytes_little_endian() NOEXCEPT;
+    inline uint32_t read_4_bytes_little_endian() NOEXCEPT;
+    inline uint64_t read_8_bytes_little_endian() NOEXCEPT;
+
+    /// Read Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline uint64_t read_variable() NOEXCEPT;
+
+    /// Cast read_variable to size_t, facilitates read_bytes(read_size()).
+    /// Returns zero and invalidates stream if would exceed read limit.
+    inline size_t read_size(size_t limit=max_size_t) NOEXCEPT;
+
+    /// Convert read_4_bytes_little_endian to an error code.
+    inline code read_error_code() NOEXCEPT;
+
+    /// Read/peek one byte (invalidates an empty stream).
+    inline uint8_t peek_byte() NOEXCEPT;
+    inline uint8_t read_byte() NOEXCEPT;
+
+    /// Bytes Arrays.
+    /// -----------------------------------------------------------------------
+
+    /// Read size bytes into array.
+    template <size_t Size>
+    inline data_array<Size> read_forward() NOEXCEPT;
+    template <size_t Size>
+    inline data_array<Size> read_reverse() NOEXCEPT;
+
+    /// Read hash to stack allocated forwarded object.
+    inline mini_hash read_mini_hash() NOEXCEPT;
+    inline short_hash read_short_hash() NOEXCEPT;
+    inline hash_digest read_hash() NOEXCEPT;
+    inline long_hash read_long_hash() NOEXCEPT;
+
+    /// Bytes Vectors.
+    /// -----------------------------------------------------------------------
+    /// Non-null raw return must be destroyed using reader's allocator/arena.
+    /// Null raw return implies invalidated stream.
+
+    /// Read all remaining bytes.
+    inline data_chunk read_bytes() NOEXCEPT;
+    NODISCARD inline data_chunk* read_bytes_raw() NOEXCEPT;
+
+    /// Read size bytes, return size is guaranteed.
+    inline data_chunk read_bytes(size_t size) NOEXCEPT;
+    NODISCARD inline data_chunk* read_bytes_raw(size_t size) NOEXCEPT;
+
+    /// Read size bytes to buffer, return size is guaranteed.
+    inline void read_bytes(uint8_t* buffer, size_t size) NOEXCEPT;
+
+    /// Read size bytes as a view of the source buffer (empty if invalid).
+    inline data_slice read_slice(size_t size) NOEXCEPT;
+
+    /// Control.
+    /// -----------------------------------------------------------------------
+
+    /// Advance the iterator.
+    inline void skip_byte() NOEXCEPT;
+    inline void skip_bytes(size_t size) NOEXCEPT;
+
+    /// Read one byte and advance the iterator accordingly.
+    inline void skip_variable() NOEXCEPT;
+
+    /// Rewind the iterator.
+    inline void rewind_byte() NOEXCEPT;
+    inline void rewind_bytes(size_t size) NOEXCEPT;
+
+    /// The stream is empty (or invalid).
+    inline bool is_exhausted() const NOEXCEPT;
+
+    /// Get the current absolute position.
+    inline size_t get_read_position() const NOEXCEPT;
+
+    /// Clear invalid state and set absolute position.
+    inline void set_position(size_t absolute) NOEXCEPT;
+
+    /// Invalidate the stream.
+    inline void invalidate() NOEXCEPT;
+
+    /// Memory resource used to populate vectors.
+    inline memory_arena get_arena() const NOEXCEPT;
+
+    /// Memory allocator used to construct objects.
+    inline byte_allocator& get_allocator() const NOEXCEPT;
+
+    /// The stream is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The stream is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    static constexpr uint8_t pad() { return 0x00; };
+
+    inline size_t remaining() const NOEXCEPT;
+    inline const uint8_t* advance(size_t size) NOEXCEPT;
+
+    const uint8_t* begin_;
+    const uint8_t* position_;
+    const uint8_t* end_;
+    bool valid_;
+    mutable byte_allocator allocator_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/fast_reader.ipp>
+
+#endif
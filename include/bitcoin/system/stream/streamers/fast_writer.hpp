@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_WRITER_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_FAST_WRITER_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// A final, non-virtual byte writer over a pre-sized contiguous byte buffer.
+/// This is not a bytewriter, its members are resolved (and inlined) at
+/// compile time. It writes the same buffer as byte_writer<stream::out::fast>,
+/// directly, so that each field write is a single bounds comparison and copy.
+/// Bytes are not partially written on overflow, the writer is just
+/// invalidated, so that validity can be tested once per object.
+class fast_writer final
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(fast_writer);
+
+    /// Constructors.
+    inline fast_writer(const data_slab& sink) NOEXCEPT;
+
+    /// Integrals.
+    /// -----------------------------------------------------------------------
+
+    /// Write integer, size determined from parameter type.
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline void write_big_endian(Integer value) NOEXCEPT;
+    template <typename Integer, size_t Size = sizeof(Integer),
+        if_integer<Integer> = true,
+        if_not_greater<Size, sizeof(Integer)> = true>
+    inline void write_little_endian(Integer value) NOEXCEPT;
+
+    /// Write big endian (explicit specializations of write_big_endian).
+    inline void write_2_bytes_big_endian(uint16_t value) NOEXCEPT;
+    inline void write_4_bytes_big_endian(uint32_t value) NOEXCEPT;
+    inline void write_8_bytes_big_endian(uint64_t value) NOEXCEPT;
+
+    /// Little endian integer writers (specializations of write_little_endian).
+    inline void write_2_bytes_little_endian(uint16_t value) NOEXCEPT;
+    inline void write_4_bytes_little_endian(uint32_t value) NOEXCEPT;
+    inline void write_8_bytes_little_endian(uint64_t value) NOEXCEPT;
+
+    /// Write Bitcoin variable integer (1, 3, 5, or 9 bytes, little-endian).
+    inline void write_variable(uint64_t value) NOEXCEPT;
+
+    /// Call write_4_bytes_little_endian with integer value of error code.
+    inline void write_error_code(const code& ec) NOEXCEPT;
+
+    /// Write one byte.
+    inline void write_byte(uint8_t value) NOEXCEPT;
+
+    /// Bytes.
+    /// -----------------------------------------------------------------------
+
+    /// Write all bytes.
+    inline void write_bytes(const data_slice& data) NOEXCEPT;
+
+    /// Write size bytes.
+    inline void write_bytes(const uint8_t* data, size_t size) NOEXCEPT;
+
+    /// Control.
+    /// -----------------------------------------------------------------------
+
+    /// Advance the iterator, skipped bytes are unchanged.
+    inline void skip_bytes(size_t size) NOEXCEPT;
+
+    /// The buffer is full (or invalid).
+    inline bool is_exhausted() const NOEXCEPT;
+
+    /// Get the current absolute position.
+    inline size_t get_write_position() const NOEXCEPT;
+
+    /// Invalidate the stream.
+    inline void invalidate() NOEXCEPT;
+
+    /// The stream is valid.
+    inline operator bool() const NOEXCEPT;
+
+    /// The stream is invalid.
+    inline bool operator!() const NOEXCEPT;
+
+private:
+    inline size_t remaining() const NOEXCEPT;
+    inline uint8_t* advance(size_t size) NOEXCEPT;
+
+    uint8_t* begin_;
+    uint8_t* position_;
+    uint8_t* end_;
+    bool valid_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/stream/streamers/fast_writer.ipp>
+
+#endif
@@ -39,6 +39,14 @@ public:
     /// Constructors.
     sha256t_writer(OStream& sink) NOEXCEPT;
 
+    /// Continue hashing from a precomputed context (midstate).
+    /// The context must have been initialized from midstate().
+    sha256t_writer(OStream& sink,
+        const accumulator<sha256>& context) NOEXCEPT;
+
+    /// The tagged hash midstate, with one block accumulated.
+    static constexpr sha256::state_t midstate() NOEXCEPT;
+
     /// Flush on destruct.
     ~sha256t_writer() NOEXCEPT override;
 
@@ -55,8 +63,6 @@ protected:
     void do_flush() NOEXCEPT override;
 
 private:
-    static constexpr sha256::state_t midstate() NOEXCEPT;
-
     void flusher() NOEXCEPT;
 
     accumulator<sha256> context_;
@@ -39,6 +39,10 @@ public:
     /// Constructors.
     sha256x2_writer(OStream& sink) NOEXCEPT;
 
+    /// Continue hashing from a precomputed context (midstate).
+    sha256x2_writer(OStream& sink,
+        const accumulator<sha256>& context) NOEXCEPT;
+
     /// Flush on destruct.
     ~sha256x2_writer() NOEXCEPT override;
 
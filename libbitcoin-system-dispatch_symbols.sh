@@ -0,0 +1,45 @@
+#!/bin/sh
+###############################################################################
+#  Copyright (c) 2014-2026 libbitcoin-system developers (see COPYING).
+#
+###############################################################################
+
+# Kernel objects are compiled for a wider instruction set than the library.
+# Any external code symbol other than a kernel entry point could be selected
+# by the linker in place of the library (portable) definition, and fault on a
+# cpu without that instruction set (see src/hash/kernels.hpp).
+#==============================================================================
+BUILD_DIRECTORY="${1:-.}"
+KERNEL_ENTRIES=\
+"^libbitcoin::system::sha::"\
+"(iterate|merkle|batch|rmd_halves|rmd_batch|sip_batch)_"\
+"(avx2|avx512|native)\("
+
+
+# Check kernel objects.
+#==============================================================================
+KERNEL_OBJECTS=$(find "${BUILD_DIRECTORY}" -type f \( \
+    -name "*dispatch_avx2*.o" -o \
+    -name "*dispatch_avx512*.o" -o \
+    -name "*dispatch_native*.o" \))
+
+if [ -z "${KERNEL_OBJECTS}" ]; then
+    echo "No kernel objects found in ${BUILD_DIRECTORY}."
+    exit 1
+fi
+
+RESULT=0
+for KERNEL_OBJECT in ${KERNEL_OBJECTS}; do
+    # Defined external code symbols (text, weak, indirect function).
+    EXPORTED=$(nm -g -C --defined-only "${KERNEL_OBJECT}" |
+        awk '$2 ~ /^[TWi]$/ { $1 = ""; $2 = ""; sub(/^  /, ""); print }' |
+        grep -Ev "${KERNEL_ENTRIES}")
+
+    if [ -n "${EXPORTED}" ]; then
+        echo "${KERNEL_OBJECT} exports non-kernel code symbols:"
+        echo "${EXPORTED}"
+        RESULT=1
+    fi
+done
+
+exit ${RESULT}
@@ -18,7 +18,10 @@
  */
 #include <bitcoin/system/arena.hpp>
 
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
+#include <memory>
 #include <bitcoin/system/constants.hpp>
 
 namespace libbitcoin {
@@ -75,4 +78,119 @@ void default_arena::release(void*) NOEXCEPT
 {
 }
 
+// linear_arena
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_MALLOC_OR_FREE)
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+linear_arena::linear_arena(size_t minimum) NOEXCEPT
+  : minimum_(minimum)
+{
+}
+
+linear_arena::~linear_arena() NOEXCEPT
+{
+    // Free any allocation that was started but not detached.
+    release(memory_);
+}
+
+// Allocates initial buffer of at least baseline bytes, returns its address.
+void* linear_arena::start(size_t baseline) THROWS
+{
+    // Free any allocation that was started but not detached.
+    release(memory_);
+    detach();
+
+    memory_ = extend(baseline);
+    return memory_;
+}
+
+// Transfers allocation to caller (via start() return), returns total size.
+size_t linear_arena::detach() NOEXCEPT
+{
+    const auto size = size_;
+    memory_ = nullptr;
+    current_ = nullptr;
+    size_ = zero;
+    offset_ = zero;
+    return size;
+}
+
+// Frees all buffers of a (detached) allocation, independent of arena state.
+void linear_arena::release(void* address) NOEXCEPT
+{
+    for (auto buffer = static_cast<link*>(address); buffer != nullptr;)
+    {
+        const auto next = buffer->next;
+        std::free(buffer);
+        buffer = next;
+    }
+}
+
+uint8_t* linear_arena::data(link* buffer) NOEXCEPT
+{
+    return reinterpret_cast<uint8_t*>(buffer) + link_size;
+}
+
+linear_arena::link* linear_arena::extend(size_t bytes) THROWS
+{
+    const auto size = std::max(bytes, minimum_);
+    if (size > std::numeric_limits<size_t>::max() - link_size)
+        throw allocation_exception();
+
+    const auto buffer = static_cast<link*>(std::malloc(link_size + size));
+    if (buffer == nullptr)
+        throw allocation_exception();
+
+    buffer->next = nullptr;
+    buffer->size = size;
+    size_ += size;
+    offset_ = zero;
+
+    if (current_ != nullptr)
+        current_->next = buffer;
+
+    current_ = buffer;
+    return buffer;
+}
+
+void* linear_arena::do_allocate(size_t bytes, size_t align) THROWS
+{
+    // Implicitly start when not started (allocation then must be detached).
+    if (current_ == nullptr)
+        memory_ = extend(bytes + align);
+
+    void* ptr = data(current_) + offset_;
+    auto space = current_->size - offset_;
+
+    // Extend when the aligned allocation does not fit the current buffer.
+    if (std::align(align, bytes, ptr, space) == nullptr)
+    {
+        extend(std::max(bytes + align, current_->size));
+        ptr = data(current_);
+        space = current_->size;
+        std::align(align, bytes, ptr, space);
+    }
+
+    offset_ = current_->size - space + bytes;
+    return ptr;
+}
+
+// Memory is freed only by release().
+void linear_arena::do_deallocate(void*, size_t, size_t) NOEXCEPT
+{
+}
+
+bool linear_arena::do_is_equal(const arena& other) const NOEXCEPT
+{
+    // Do not cross the streams.
+    return &other == this;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 } // namespace libbitcoin
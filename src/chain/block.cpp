@@ -34,6 +34,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/machine/machine.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
@@ -71,7 +72,7 @@ block::block(const chain::header::cptr& header,
 }
 
 block::block(const data_slice& data, bool witness) NOEXCEPT
-  : block(stream::in::fast(data), witness)
+  : block(fast_reader(data), witness)
 {
 }
 
@@ -97,6 +98,12 @@ block::block(reader&& source, bool witness) NOEXCEPT
 {
 }
 
+// protected
+block::block(fast_reader&& source, bool witness) NOEXCEPT
+  : block(source, witness)
+{
+}
+
 block::block(reader& source, bool witness) NOEXCEPT
   : header_(CREATE(chain::header, source.get_allocator(), source)),
     txs_(CREATE(transaction_cptrs, source.get_allocator()))
@@ -104,13 +111,20 @@ block::block(reader& source, bool witness) NOEXCEPT
     assign_data(source, witness);
 }
 
+block::block(fast_reader& source, bool witness) NOEXCEPT
+  : header_(CREATE(chain::header, source.get_allocator(), source)),
+    txs_(CREATE(transaction_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness);
+}
+
 // protected
 block::block(const chain::header::cptr& header,
     const transactions_cptr& txs, bool valid) NOEXCEPT
   : header_(header),
     txs_(txs),
     valid_(valid),
-    size_(serialized_size(*txs))
+    metrics_(measure(*txs))
 {
 }
 
@@ -132,9 +146,10 @@ bool block::operator!=(const block& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void block::assign_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+void block::assign_data(Source& source, bool witness) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
     const auto count = source.read_size(max_block_size);
     auto txs = to_non_const_raw_ptr(txs_);
     txs->reserve(count);
@@ -142,10 +157,35 @@ void block::assign_data(reader& source, bool witness) NOEXCEPT
     for (size_t tx{}; tx < count; ++tx)
         txs->emplace_back(CREATE(transaction, allocator, source, witness));
 
-    size_ = serialized_size(*txs_);
+    metrics_ = measure(*txs_);
     valid_ = source;
 }
 
+// static
+block::cptr block::from_arena(arena& memory, const data_slice& data,
+    bool witness) NOEXCEPT
+{
+    // Non-detachable arena returns nullptr and deallocates each object.
+    const auto allocation = memory.start(data.size());
+
+    fast_reader source(data, &memory);
+    const auto ptr = source.get_allocator().new_object<block>(source, witness);
+    ptr->set_allocation(memory.detach());
+
+    return
+    {
+        ptr, [&memory, allocation](block* instance) NOEXCEPT
+        {
+            byte_allocator::destroy<block>(instance);
+
+            if (is_null(allocation))
+                memory.deallocate(instance, sizeof(block), alignof(block));
+            else
+                memory.release(allocation);
+        }
+    };
+}
+
 void block::set_allocation(size_t allocation) const NOEXCEPT
 {
     allocation_ = allocation;
@@ -156,14 +196,18 @@ size_t block::get_allocation() const NOEXCEPT
     return allocation_;
 }
 
+void block::set_signature_operations() const NOEXCEPT
+{
+    legacy_sigops_ = legacy_signature_operations();
+}
+
 // Serialization.
 // ----------------------------------------------------------------------------
 
 data_chunk block::to_data(bool witness) const NOEXCEPT
 {
     data_chunk data(serialized_size(witness));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out, witness);
     return data;
 }
@@ -175,6 +219,18 @@ void block::to_data(std::ostream& stream, bool witness) const NOEXCEPT
 }
 
 void block::to_data(writer& sink, bool witness) const NOEXCEPT
+{
+    write_data(sink, witness);
+}
+
+void block::to_data(fast_writer& sink, bool witness) const NOEXCEPT
+{
+    write_data(sink, witness);
+}
+
+// private
+template <typename Sink>
+void block::write_data(Sink& sink, bool witness) const NOEXCEPT
 {
     header_->to_data(sink);
     sink.write_variable(txs_->size());
@@ -183,6 +239,15 @@ void block::to_data(writer& sink, bool witness) const NOEXCEPT
         tx->to_data(sink, witness);
 }
 
+void block::to_data(gather& sink) const NOEXCEPT
+{
+    header_->to_data(sink);
+    sink.write_variable(txs_->size());
+
+    for (const auto& tx: *txs_)
+        tx->to_data(sink);
+}
+
 // Properties.
 // ----------------------------------------------------------------------------
 
@@ -248,32 +313,14 @@ hashes block::transaction_hashes(bool witness) const NOEXCEPT
 // computed
 size_t block::outputs() const NOEXCEPT
 {
-    if (txs_->empty())
-        return zero;
-
-    // Overflow returns max_size_t.
-    const auto outs = [](size_t total, const auto& tx) NOEXCEPT
-    {
-         return ceilinged_add(total, tx->outputs());
-    };
-
-    return std::accumulate(std::next(txs_->begin()), txs_->end(), zero, outs);
+    return metrics_.outputs;
 }
 
 // computed
 size_t block::spends() const NOEXCEPT
 {
-    if (txs_->empty())
-        return zero;
-
-    // Overflow returns max_size_t.
-    const auto ins = [](size_t total, const auto& tx) NOEXCEPT
-    {
-         return ceilinged_add(total, tx->inputs());
-    };
-
     // inputs() is add1(spends()) if the block is valid (one coinbase input).
-    return std::accumulate(std::next(txs_->begin()), txs_->end(), zero, ins);
+    return metrics_.spends;
 }
 
 // computed
@@ -326,6 +373,22 @@ void block::set_hashes(const data_chunk& data) NOEXCEPT
     }
 }
 
+void block::set_transaction_hashes(bool witness) const NOEXCEPT
+{
+    const auto nominal = batch_transaction_hashes(false);
+    for (size_t index{}; index < nominal.size(); ++index)
+        txs_->at(index)->set_nominal_hash(nominal.at(index));
+
+    if (!witness)
+        return;
+
+    // Witness hash of coinbase is null_hash [bip141].
+    const auto witnessed = batch_transaction_hashes(true);
+    for (size_t index = one; index < witnessed.size(); ++index)
+        if (txs_->at(index)->is_segregated())
+            txs_->at(index)->set_witness_hash(witnessed.at(index));
+}
+
 const chain_state::cptr& block::get_state() const NOEXCEPT
 {
     return header_->get_state();
@@ -337,28 +400,52 @@ void block::set_state(const chain_state::cptr& state) const NOEXCEPT
 }
 
 // static/private
-block::sizes block::serialized_size(const transaction_cptrs& txs) NOEXCEPT
+block::metrics block::measure(const transaction_cptrs& txs) NOEXCEPT
 {
-    sizes size{};
-    std::for_each(txs.begin(), txs.end(), [&](const auto& tx) NOEXCEPT
+    // Overflow returns max_size_t.
+    metrics out{};
+    auto nominal = zero;
+    auto witnessed = zero;
+
+    for (auto tx = txs.begin(); tx != txs.end(); ++tx)
     {
-        size.nominal = ceilinged_add(size.nominal, tx->serialized_size(false));
-        size.witnessed = ceilinged_add(size.witnessed,
-            tx->serialized_size(true));
-    });
+        const auto& transaction = **tx;
+        nominal = ceilinged_add(nominal, transaction.serialized_size(false));
+        witnessed = ceilinged_add(witnessed, transaction.serialized_size(true));
+
+        if (transaction.is_segregated())
+            ++out.segregated;
+
+        // Coinbase outputs and (null) input are excluded.
+        if (tx != txs.begin())
+        {
+            out.outputs = ceilinged_add(out.outputs, transaction.outputs());
+            out.spends = ceilinged_add(out.spends, transaction.inputs());
+        }
+    }
 
     const auto base_size = ceilinged_add(header::serialized_size(),
         variable_size(txs.size()));
 
-    const auto nominal_size = ceilinged_add(base_size, size.nominal);
-    const auto witnessed_size = ceilinged_add(base_size, size.witnessed);
+    out.nominal = ceilinged_add(base_size, nominal);
+    out.witnessed = ceilinged_add(base_size, witnessed);
 
-    return { nominal_size, witnessed_size };
+    // Block weight is 3 * nominal size * + 1 * witness size [bip141].
+    out.weight = ceilinged_add(
+        ceilinged_multiply(base_size_contribution, out.nominal),
+        ceilinged_multiply(total_size_contribution, out.witnessed));
+
+    return out;
+}
+
+const block::metrics& block::get_metrics() const NOEXCEPT
+{
+    return metrics_;
 }
 
 size_t block::serialized_size(bool witness) const NOEXCEPT
 {
-    return witness ? size_.witnessed : size_.nominal;
+    return witness ? metrics_.witnessed : metrics_.nominal;
 }
 
 // Check (context free).
@@ -434,6 +521,71 @@ bool block::is_internal_double_spend() const NOEXCEPT
 }
 
 // private
+hashes block::batch_transaction_hashes(bool witness) const NOEXCEPT
+{
+    // Extra allocation for odd count optimizes for merkle root.
+    // Vector capacity is never reduced when resizing to smaller size.
+    const auto count = txs_->size();
+    const auto size = !is_one(count) && is_odd(count) ? add1(count) : count;
+    hashes out(size);
+    out.resize(count);
+
+    // Witness hash of segregated coinbase is null_hash [bip141].
+    const auto computed = [&](size_t index) NOEXCEPT
+    {
+        const auto& tx = txs_->at(index);
+        return tx->has_hash(witness) ||
+            (witness && tx->is_segregated() && tx->is_coinbase());
+    };
+
+    // Uncached txs are serialized to one buffer, each at its own offset.
+    std_vector<size_t> offsets(add1(count));
+    for (size_t index{}; index < count; ++index)
+        offsets.at(add1(index)) = offsets.at(index) + (computed(index) ?
+            zero : txs_->at(index)->serialized_size(witness));
+
+    data_chunk buffer(offsets.back());
+
+    // Sets of txs are serialized and batch hashed concurrently (vector lanes).
+    constexpr size_t set_size = 64;
+    std_vector<size_t> sets(ceilinged_divide(count, set_size));
+    std::iota(sets.begin(), sets.end(), zero);
+
+    std::for_each(poolstl::execution::par_if(sets.size() > one),
+        sets.begin(), sets.end(), [&](size_t set) NOEXCEPT
+        {
+            const auto first = set * set_size;
+            const auto last = std::min(count, first + set_size);
+            std_vector<size_t> uncached{};
+            sha256::slices_t messages{};
+
+            for (auto index = first; index < last; ++index)
+            {
+                const auto& tx = txs_->at(index);
+                if (computed(index))
+                {
+                    out.at(index) = tx->hash(witness);
+                    continue;
+                }
+
+                const auto begin = std::next(buffer.data(), offsets.at(index));
+                const auto end = std::next(buffer.data(),
+                    offsets.at(add1(index)));
+
+                fast_writer sink{ { begin, end } };
+                tx->to_data(sink, witness);
+                messages.emplace_back(begin, end);
+                uncached.push_back(index);
+            }
+
+            const auto digests = sha256::double_hash_batch(messages);
+            for (size_t item{}; item < uncached.size(); ++item)
+                out.at(uncached.at(item)) = digests.at(item);
+        });
+
+    return out;
+}
+
 hash_digest block::generate_merkle_root(bool witness) const NOEXCEPT
 {
     return sha256::merkle_root(transaction_hashes(witness));
@@ -472,10 +624,7 @@ hashes block::merkle_branch(size_t position, bool witness) const NOEXCEPT
 
 size_t block::weight() const NOEXCEPT
 {
-    // Block weight is 3 * nominal size * + 1 * witness size [bip141].
-    return ceilinged_add(
-        ceilinged_multiply(base_size_contribution, serialized_size(false)),
-        ceilinged_multiply(total_size_contribution, serialized_size(true)));
+    return metrics_.weight;
 }
 
 size_t block::virtual_size() const NOEXCEPT
@@ -613,22 +762,12 @@ bool block::is_malleated64() const NOEXCEPT
 
 bool block::is_segregated() const NOEXCEPT
 {
-    const auto segregated = [](const auto& tx) NOEXCEPT
-    {
-        return tx->is_segregated();
-    };
-
-    return std::any_of(txs_->begin(), txs_->end(), segregated);
+    return !is_zero(metrics_.segregated);
 }
 
 size_t block::segregated() const NOEXCEPT
 {
-    const auto count_segregated = [](const auto& tx) NOEXCEPT
-    {
-        return tx->is_segregated();
-    };
-
-    return std::count_if(txs_->begin(), txs_->end(), count_segregated);
+    return metrics_.segregated;
 }
 
 // Last output of commitment pattern holds the committed value [bip141].
@@ -731,16 +870,46 @@ bool block::is_overspent(size_t height, uint64_t subsidy_interval,
         initial_block_subsidy_satoshi, bip42);
 }
 
+// private
+size_t block::legacy_signature_operations() const NOEXCEPT
+{
+    if (legacy_sigops_.has_value())
+        return legacy_sigops_.value();
+
+    // Not cached here (see set_signature_operations), overflow is max_size_t.
+    auto sigops = zero;
+    for (const auto& tx: *txs_)
+    {
+        // Count sigops in input and output scripts (inaccurate).
+        for (const auto& input: *tx->inputs_ptr())
+            sigops = ceilinged_add(sigops,
+                input->script().signature_operations(false));
+
+        for (const auto& output: *tx->outputs_ptr())
+            sigops = ceilinged_add(sigops,
+                output->script().signature_operations(false));
+    }
+
+    return sigops;
+}
+
 size_t block::signature_operations(bool bip16, bool bip141) const NOEXCEPT
 {
+    // Sigops in input and output scripts are heavy [bip141].
+    const auto factor = bip141 ? heavy_sigops_factor : one;
+    auto sigops = ceilinged_multiply(legacy_signature_operations(), factor);
+
+    // Only embedded and witness sigops are dependent upon prevouts.
+    if (!bip16 && !bip141)
+        return sigops;
+
     // Overflow returns max_size_t.
-    const auto value = [=](size_t total, const auto& tx) NOEXCEPT
-    {
-        const auto add = tx->signature_operations(bip16, bip141);
-        return ceilinged_add(total, add);
-    };
+    for (const auto& tx: *txs_)
+        for (const auto& input: *tx->inputs_ptr())
+            sigops = ceilinged_add(sigops,
+                input->embedded_signature_operations(bip16, bip141));
 
-    return std::accumulate(txs_->begin(), txs_->end(), zero, value);
+    return sigops;
 }
 
 bool block::is_signature_operations_limited(bool bip16,
@@ -825,14 +994,40 @@ code block::accept_transactions(const context& ctx) const NOEXCEPT
 }
 
 // Do NOT invoke on coinbase.
-code block::connect_transactions(const context& ctx) const NOEXCEPT
+// Concurrency is by transaction, as signature hash caching is not thread safe.
+// Concurrency assumes no prevout is shared by inputs (see script offset), which
+// is assured by check() (is_internal_double_spend).
+code block::connect_transactions(const context& ctx,
+    bool concurrent) const NOEXCEPT
 {
-    if (!is_empty())
+    if (is_empty())
+        return error::block_success;
+
+    // Terminal schnorr signature and taproot commitment verifications are
+    // deferred and verified concurrently (commitment hashes in vector lanes).
+    // A deferred failure precedes the first non-deferred failure (if any).
+    if (!concurrent)
+    {
+        machine::signature_batch batch{};
         for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
-            if (const auto ec = (*tx)->connect(ctx))
-                return ec;
+            if (const auto ec = (*tx)->connect(ctx, batch))
+                return batch.verify(ec);
 
-    return error::block_success;
+        return batch.verify(error::block_success);
+    }
+
+    const auto failed = [&ctx](const auto& tx) NOEXCEPT
+    {
+        return !!tx->connect(ctx);
+    };
+
+    // A failure cancels connection of all subsequent (not preceding) txs, so
+    // the first failure in block order is found, as with serial connection.
+    const auto tx = std::find_if(poolstl::execution::par,
+        std::next(txs_->begin()), txs_->end(), failed);
+
+    // The failed tx is reconnected to obtain its code (not a success path).
+    return tx == txs_->end() ? error::block_success : (*tx)->connect(ctx);
 }
 
 // Do NOT invoke on coinbase.
@@ -955,9 +1150,9 @@ code block::confirm(const context& ctx) const NOEXCEPT
 // forks
 
 // This assumes that prevout caching is completed on all inputs.
-code block::connect(const context& ctx) const NOEXCEPT
+code block::connect(const context& ctx, bool concurrent) const NOEXCEPT
 {
-    return connect_transactions(ctx);
+    return connect_transactions(ctx, concurrent);
 }
 
 BC_POP_WARNING()
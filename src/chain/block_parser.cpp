@@ -0,0 +1,506 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_parser.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Bounds checked cursor for scanning a possibly incomplete serialization.
+class scanner
+{
+public:
+    scanner(const data_slice& data) NOEXCEPT
+      : it_(data.data()), end_(std::next(data.data(), data.size()))
+    {
+    }
+
+    bool skip(size_t size) NOEXCEPT
+    {
+        if (!(*this) || size > available())
+        {
+            short_ = true;
+            return false;
+        }
+
+        it_ += size;
+        return true;
+    }
+
+    uint8_t peek() NOEXCEPT
+    {
+        if (!(*this) || is_zero(available()))
+        {
+            short_ = true;
+            return 0;
+        }
+
+        return *it_;
+    }
+
+    size_t read_size() NOEXCEPT
+    {
+        const auto prefix = peek();
+        if (!skip(one))
+            return zero;
+
+        const auto width = prefix == varint_eight_bytes ? 8u :
+            prefix == varint_four_bytes ? 4u :
+            prefix == varint_two_bytes ? 2u : 0u;
+
+        uint64_t value{ prefix };
+        if (!is_zero(width))
+        {
+            const auto start = it_;
+            if (!skip(width))
+                return zero;
+
+            value = 0;
+            for (auto byte = width; !is_zero(byte); --byte)
+                value = shift_left(value, byte_bits) | start[sub1(byte)];
+        }
+
+        // Sizes are limited as in deserialization (read_size).
+        if (value > max_block_size)
+        {
+            invalid_ = true;
+            return zero;
+        }
+
+        return possible_narrow_cast<size_t>(value);
+    }
+
+    bool is_short() const NOEXCEPT
+    {
+        return short_;
+    }
+
+    bool is_invalid() const NOEXCEPT
+    {
+        return invalid_;
+    }
+
+    size_t consumed(const data_slice& data) const NOEXCEPT
+    {
+        return possible_narrow_sign_cast<size_t>(std::distance(data.data(), it_));
+    }
+
+    operator bool() const NOEXCEPT
+    {
+        return !short_ && !invalid_;
+    }
+
+private:
+    size_t available() const NOEXCEPT
+    {
+        return possible_narrow_sign_cast<size_t>(std::distance(it_, end_));
+    }
+
+    const uint8_t* it_;
+    const uint8_t* end_;
+    bool short_{};
+    bool invalid_{};
+};
+
+BC_POP_WARNING()
+
+// Smallest transaction: version, input (null script), output (null script),
+// locktime, and the two counts.
+constexpr auto min_transaction_size = sizeof(uint32_t) + one +
+    (point::serialized_size() + one + sizeof(uint32_t)) + one +
+    (sizeof(uint64_t) + one) + sizeof(uint32_t);
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+block_parser::block_parser(bool witness) NOEXCEPT
+  : witness_(witness)
+{
+}
+
+// Parse.
+// ----------------------------------------------------------------------------
+
+transaction_cptrs block_parser::push(const data_slice& chunk) NOEXCEPT
+{
+    transaction_cptrs out{};
+    if (failed_)
+        return out;
+
+    if (is_complete())
+    {
+        if (!chunk.empty())
+            fail();
+
+        return out;
+    }
+
+    // Release parsed bytes only once they exceed the unparsed remainder, so
+    // each byte is moved at most once (amortized) by compaction.
+    if (offset_ > remaining())
+    {
+        buffer_.erase(buffer_.begin(), std::next(buffer_.begin(), offset_));
+        offset_ = zero;
+    }
+
+    buffer_.insert(buffer_.end(), chunk.begin(), chunk.end());
+
+    if (!header_ && !parse_header())
+        return out;
+
+    if (!counted_ && !parse_count())
+        return out;
+
+    while (txs_->size() < declared_)
+    {
+        const auto tx = parse_transaction();
+        if (!tx)
+            return out;
+
+        txs_->push_back(tx);
+        out.push_back(tx);
+    }
+
+    // Bytes beyond the last transaction are not part of the block.
+    if (!is_zero(remaining()))
+        fail();
+
+    return out;
+}
+
+// private
+bool block_parser::parse_header() NOEXCEPT
+{
+    constexpr auto size = header::serialized_size();
+    if (remaining() < size)
+        return false;
+
+    header_ = to_shared<header>(data_slice{ next(), std::next(next(), size) });
+    if (!header_->is_valid())
+    {
+        fail();
+        return false;
+    }
+
+    offset_ += size;
+    consumed_ += size;
+    return true;
+}
+
+// private
+bool block_parser::parse_count() NOEXCEPT
+{
+    const data_slice data{ next(), std::next(next(), remaining()) };
+    scanner source(data);
+    const auto count = source.read_size();
+    if (source.is_invalid())
+    {
+        fail();
+        return false;
+    }
+
+    if (source.is_short())
+        return false;
+
+    const auto size = source.consumed(data);
+    declared_ = count;
+    counted_ = true;
+
+    // The count is untrusted, so reserve only for the bytes already pushed.
+    txs_->reserve(std::min(count, (remaining() - size) / min_transaction_size));
+    offset_ += size;
+    consumed_ += size;
+    return true;
+}
+
+// private
+transaction::cptr block_parser::parse_transaction() NOEXCEPT
+{
+    const auto size = scan();
+    if (size == max_size_t)
+    {
+        fail();
+        return {};
+    }
+
+    if (is_zero(size))
+        return {};
+
+    const data_slice bytes{ next(), std::next(next(), size) };
+    const auto tx = to_shared<transaction>(bytes, witness_);
+    if (!tx->is_valid())
+    {
+        fail();
+        return {};
+    }
+
+    // Wire bytes are the witness form, and also nominal if not segregated.
+    // Witness hash of coinbase is null_hash [bip141].
+    if (tx->is_segregated())
+    {
+        tx->set_nominal_hash(tx->hash(false));
+        if (!txs_->empty())
+            tx->set_witness_hash(bitcoin_hash(bytes.size(), bytes.data()));
+    }
+    else
+    {
+        tx->set_nominal_hash(bitcoin_hash(bytes.size(), bytes.data()));
+    }
+
+    scan_ = {};
+    offset_ += size;
+    consumed_ += size;
+    return tx;
+}
+
+// private
+void block_parser::fail() NOEXCEPT
+{
+    failed_ = true;
+    buffer_.clear();
+    offset_ = zero;
+    scan_ = {};
+}
+
+// private
+size_t block_parser::remaining() const NOEXCEPT
+{
+    return buffer_.size() - offset_;
+}
+
+// private
+const uint8_t* block_parser::next() const NOEXCEPT
+{
+    return std::next(buffer_.data(), offset_);
+}
+
+// private
+size_t block_parser::scan() NOEXCEPT
+{
+    constexpr auto point_size = point::serialized_size();
+    const data_slice data{ std::next(next(), scan_.cursor),
+        std::next(next(), remaining()) };
+
+    // Each step is atomic, progress is committed only once it is complete.
+    scanner source(data);
+    auto mark = zero;
+    auto& at = scan_.at;
+    while (source && at != step::complete)
+    {
+        switch (at)
+        {
+            case step::version:
+            {
+                if (source.skip(sizeof(uint32_t)))
+                    at = step::input_count;
+
+                break;
+            }
+            case step::input_count:
+            {
+                const auto count = source.read_size();
+                if (!source)
+                    break;
+
+                // Detect witness as no inputs (marker) and expected flag
+                // [bip144], in which case the count follows the flag.
+                if (!scan_.segregated && count == witness_marker)
+                {
+                    const auto flag = source.peek();
+                    if (!source)
+                        break;
+
+                    if (flag == witness_enabled)
+                    {
+                        source.skip(one);
+                        scan_.segregated = true;
+                        break;
+                    }
+                }
+
+                scan_.inputs = count;
+                scan_.index = zero;
+                at = is_zero(count) ? step::output_count : step::input_point;
+                break;
+            }
+            case step::input_point:
+            {
+                if (source.skip(point_size))
+                    at = step::input_script;
+
+                break;
+            }
+            case step::input_script:
+            {
+                if (source.skip(source.read_size()))
+                    at = step::input_sequence;
+
+                break;
+            }
+            case step::input_sequence:
+            {
+                if (source.skip(sizeof(uint32_t)))
+                    at = (++scan_.index < scan_.inputs) ? step::input_point :
+                        step::output_count;
+
+                break;
+            }
+            case step::output_count:
+            {
+                const auto count = source.read_size();
+                if (!source)
+                    break;
+
+                scan_.outputs = count;
+                scan_.index = zero;
+                at = !is_zero(count) ? step::output_value :
+                    (scan_.segregated && !is_zero(scan_.inputs)) ?
+                        step::witness_count : step::locktime;
+                break;
+            }
+            case step::output_value:
+            {
+                if (source.skip(sizeof(uint64_t)))
+                    at = step::output_script;
+
+                break;
+            }
+            case step::output_script:
+            {
+                if (!source.skip(source.read_size()))
+                    break;
+
+                if (++scan_.index < scan_.outputs)
+                    at = step::output_value;
+                else if (scan_.segregated && !is_zero(scan_.inputs))
+                {
+                    scan_.index = zero;
+                    at = step::witness_count;
+                }
+                else
+                    at = step::locktime;
+
+                break;
+            }
+            case step::witness_count:
+            {
+                const auto count = source.read_size();
+                if (!source)
+                    break;
+
+                scan_.elements = count;
+                scan_.element = zero;
+                if (!is_zero(count))
+                    at = step::witness_element;
+                else if (++scan_.index == scan_.inputs)
+                    at = step::locktime;
+
+                break;
+            }
+            case step::witness_element:
+            {
+                if (!source.skip(source.read_size()))
+                    break;
+
+                if (++scan_.element == scan_.elements)
+                    at = (++scan_.index < scan_.inputs) ? step::witness_count :
+                        step::locktime;
+
+                break;
+            }
+            case step::locktime:
+            {
+                if (source.skip(sizeof(uint32_t)))
+                    at = step::complete;
+
+                break;
+            }
+            case step::complete:
+            default:
+                break;
+        }
+
+        if (source)
+            mark = source.consumed(data);
+    }
+
+    scan_.cursor += mark;
+
+    if (source.is_invalid())
+        return max_size_t;
+
+    return at == step::complete ? scan_.cursor : zero;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool block_parser::is_complete() const NOEXCEPT
+{
+    return !failed_ && counted_ && txs_->size() == declared_;
+}
+
+bool block_parser::is_failed() const NOEXCEPT
+{
+    return failed_;
+}
+
+size_t block_parser::position() const NOEXCEPT
+{
+    return consumed_;
+}
+
+const header::cptr& block_parser::header_ptr() const NOEXCEPT
+{
+    return header_;
+}
+
+size_t block_parser::declared() const NOEXCEPT
+{
+    return declared_;
+}
+
+size_t block_parser::parsed() const NOEXCEPT
+{
+    return txs_->size();
+}
+
+block block_parser::to_block() const NOEXCEPT
+{
+    if (!is_complete())
+        return {};
+
+    return { header_, txs_ };
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -335,7 +335,8 @@ uint32_t chain_state::median_time_past(const data& values,
     const forks&) NOEXCEPT
 {
     // Sort the times by value to obtain the median.
-    auto times = sort_copy(values.timestamp.ordered);
+    const auto& ordered = values.timestamp.ordered;
+    auto times = sort(std_vector<uint32_t>(ordered.begin(), ordered.end()));
 
     // Consensus defines median time using modulo 2 element selection.
     // This differs from arithmetic median which averages two middle values.
@@ -615,7 +616,7 @@ chain_state::data chain_state::to_pool(const chain_state& top,
     // Alias configured forks.
     const auto& forks = top.forks_;
 
-    // Copy data from presumed previous-height block state.
+    // Copy data from presumed previous-height block state (windows shared).
     chain_state::data data{ top.data_ };
 
     // If this overflows height is zero and result is handled as invalid.
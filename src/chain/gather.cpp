@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/gather.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Writes.
+// ----------------------------------------------------------------------------
+
+void gather::set_witness(bool witness) NOEXCEPT
+{
+    witness_ = witness;
+}
+
+void gather::reference(const data_slice& data) NOEXCEPT
+{
+    // A slice smaller than its own descriptor is cheaper to copy.
+    if (data.size() < sizeof(data_slice))
+    {
+        write_bytes(data);
+        return;
+    }
+
+    segments_.push_back({ data.data(), zero, data.size(), witness_ });
+}
+
+void gather::write_byte(uint8_t value) NOEXCEPT
+{
+    buffer_.push_back(value);
+    append(one);
+}
+
+void gather::write_bytes(const data_slice& data) NOEXCEPT
+{
+    if (data.empty())
+        return;
+
+    buffer_.insert(buffer_.end(), data.begin(), data.end());
+    append(data.size());
+}
+
+void gather::write_4_bytes_little_endian(uint32_t value) NOEXCEPT
+{
+    write_bytes(to_little_endian(value));
+}
+
+void gather::write_8_bytes_little_endian(uint64_t value) NOEXCEPT
+{
+    write_bytes(to_little_endian(value));
+}
+
+void gather::write_variable(uint64_t value) NOEXCEPT
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(narrow_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_bytes(to_little_endian(narrow_cast<uint16_t>(value)));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_4_bytes_little_endian(narrow_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_8_bytes_little_endian(value);
+    }
+}
+
+// private
+void gather::append(size_t size) NOEXCEPT
+{
+    // Consecutive owned writes of the same tag coalesce into one segment.
+    if (!segments_.empty())
+    {
+        auto& last = segments_.back();
+        if (is_null(last.data) && last.witness == witness_)
+        {
+            last.size += size;
+            return;
+        }
+    }
+
+    segments_.push_back({ nullptr, buffer_.size() - size, size, witness_ });
+}
+
+// Selection.
+// ----------------------------------------------------------------------------
+
+gather::slices gather::to_slices(bool witness) const NOEXCEPT
+{
+    slices out{};
+    out.reserve(segments_.size());
+
+    for (const auto& segment: segments_)
+    {
+        if (segment.witness && !witness)
+            continue;
+
+        // Owned buffer is no longer written, so its data pointer is stable.
+        const auto data = is_null(segment.data) ?
+            std::next(buffer_.data(), segment.offset) : segment.data;
+
+        out.emplace_back(data, std::next(data, segment.size));
+    }
+
+    return out;
+}
+
+size_t gather::size(bool witness) const NOEXCEPT
+{
+    size_t total{};
+    for (const auto& segment: segments_)
+        if (!segment.witness || witness)
+            total += segment.size;
+
+    return total;
+}
+
+data_chunk gather::to_data(bool witness) const NOEXCEPT
+{
+    data_chunk out{};
+    out.reserve(size(witness));
+
+    for (const auto& slice: to_slices(witness))
+        out.insert(out.end(), slice.begin(), slice.end());
+
+    return out;
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
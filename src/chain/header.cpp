@@ -60,7 +60,7 @@ header::header(uint32_t version, const hash_digest& previous_block_hash,
 }
 
 header::header(const data_slice& data) NOEXCEPT
-  : header(stream::in::fast(data))
+  : header(fast_reader(data))
 {
 }
 
@@ -86,11 +86,22 @@ header::header(reader&& source) NOEXCEPT
 {
 }
 
+// protected
+header::header(fast_reader&& source) NOEXCEPT
+  : header(source)
+{
+}
+
 header::header(reader& source) NOEXCEPT
 {
     assign_data(source);
 }
 
+header::header(fast_reader& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 // protected
 header::header(uint32_t version, hash_digest&& previous_block_hash,
     hash_digest&& merkle_root, uint32_t timestamp, uint32_t bits,
@@ -141,7 +152,8 @@ bool header::operator!=(const header& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void header::assign_data(reader& source) NOEXCEPT
+template <typename Source>
+void header::assign_data(Source& source) NOEXCEPT
 {
     // Hashes are copied directly into to header-allocated space.
     // Integrals are stack-allocated and copied to header-allocated space.
@@ -160,8 +172,7 @@ void header::assign_data(reader& source) NOEXCEPT
 data_chunk header::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out);
     return data;
 }
@@ -173,6 +184,18 @@ void header::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void header::to_data(writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+void header::to_data(fast_writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+// private
+template <typename Sink>
+void header::write_data(Sink& sink) const NOEXCEPT
 {
     sink.write_4_bytes_little_endian(version_);
     sink.write_bytes(previous_block_hash_);
@@ -182,6 +205,16 @@ void header::to_data(writer& sink) const NOEXCEPT
     sink.write_4_bytes_little_endian(nonce_);
 }
 
+void header::to_data(gather& sink) const NOEXCEPT
+{
+    sink.write_4_bytes_little_endian(version_);
+    sink.reference(previous_block_hash_);
+    sink.reference(merkle_root_);
+    sink.write_4_bytes_little_endian(timestamp_);
+    sink.write_4_bytes_little_endian(bits_);
+    sink.write_4_bytes_little_endian(nonce_);
+}
+
 // Properties.
 // ----------------------------------------------------------------------------
 
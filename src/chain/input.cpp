@@ -140,7 +140,7 @@ input::input(const chain::point::cptr& point, const chain::script::cptr& script,
 }
 
 input::input(const data_slice& data) NOEXCEPT
-  : input(stream::in::fast(data))
+  : input(fast_reader(data))
 {
 }
 
@@ -166,6 +166,12 @@ input::input(reader&& source) NOEXCEPT
 {
 }
 
+// protected
+input::input(fast_reader&& source) NOEXCEPT
+  : input(source)
+{
+}
+
 // Witness is deserialized and assigned by transaction.
 input::input(reader& source) NOEXCEPT
   : point_(CREATE(chain::point, source.get_allocator(), source)),
@@ -177,6 +183,16 @@ input::input(reader& source) NOEXCEPT
 {
 }
 
+input::input(fast_reader& source) NOEXCEPT
+  : point_(CREATE(chain::point, source.get_allocator(), source)),
+    script_(CREATE(chain::script, source.get_allocator(), source, true)),
+    witness_(CREATE(chain::witness, source.get_allocator())),
+    sequence_(source.read_4_bytes_little_endian()),
+    valid_(source),
+    size_(serialized_size(*script_))
+{
+}
+
 // protected
 input::input(const chain::point::cptr& point, const chain::script::cptr& script,
     const chain::witness::cptr& witness, uint32_t sequence, bool valid) NOEXCEPT
@@ -235,8 +251,7 @@ bool operator!=(const cref_point& left, const cref_point& right) NOEXCEPT
 data_chunk input::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size(false));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out);
     return data;
 }
@@ -249,6 +264,25 @@ void input::to_data(std::ostream& stream) const NOEXCEPT
 
 // Witness is serialized by transaction.
 void input::to_data(writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+void input::to_data(fast_writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+// private
+template <typename Sink>
+void input::write_data(Sink& sink) const NOEXCEPT
+{
+    point_->to_data(sink);
+    script_->to_data(sink, true);
+    sink.write_4_bytes_little_endian(sequence_);
+}
+
+void input::to_data(gather& sink) const NOEXCEPT
 {
     point_->to_data(sink);
     script_->to_data(sink, true);
@@ -322,7 +356,19 @@ size_t input::witnessed_size() const NOEXCEPT
 
 void input::set_witness(reader& source) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    assign_witness(source);
+}
+
+void input::set_witness(fast_reader& source) NOEXCEPT
+{
+    assign_witness(source);
+}
+
+// private
+template <typename Source>
+void input::assign_witness(Source& source) NOEXCEPT
+{
+    byte_allocator& allocator = source.get_allocator();
     witness_.reset(CREATE(chain::witness, allocator, source, true));
     size_.witnessed = ceilinged_add(size_.nominal,
         witness_->serialized_size(true));
@@ -458,16 +504,24 @@ size_t input::signature_operations(bool bip16, bool bip141) const NOEXCEPT
     // Count heavy sigops in the input script (inaccurate).
     const auto sigops = script_->signature_operations(false) * factor;
 
+    return ceilinged_add(sigops, embedded_signature_operations(bip16, bip141));
+}
+
+size_t input::embedded_signature_operations(bool bip16,
+    bool bip141) const NOEXCEPT
+{
+    const auto factor = bip141 ? heavy_sigops_factor : one;
+
     // Null prevout/input (coinbase) cannot have witness or embedded script.
     // Embedded/witness scripts are deserialized here and again on script eval.
     if (!prevout)
-        return sigops;
+        return zero;
 
     chain::script script;
     if (bip141 && witness_->extract_sigop_script(script, prevout->script()))
     {
-        // Add sigops in the witness script (accurate) [bip141].
-        return ceilinged_add(sigops, script.signature_operations(true));
+        // Sigops in the witness script (accurate) [bip141].
+        return script.signature_operations(true);
     }
 
     chain::script embedded;
@@ -475,18 +529,17 @@ size_t input::signature_operations(bool bip16, bool bip141) const NOEXCEPT
     {
         if (bip141 && witness_->extract_sigop_script(script, embedded))
         {
-            // Add sigops in the embedded witness script (accurate) [bip141].
-            return ceilinged_add(sigops, script.signature_operations(true));
+            // Sigops in the embedded witness script (accurate) [bip141].
+            return script.signature_operations(true);
         }
         else
         {
-            // Add heavy sigops in the embedded script (accurate) [bip16].
-            return ceilinged_add(sigops, embedded.signature_operations(true) *
-                factor);
+            // Heavy sigops in the embedded script (accurate) [bip16].
+            return embedded.signature_operations(true) * factor;
         }
     }
 
-    return sigops;
+    return zero;
 }
 
 BC_POP_WARNING()
@@ -130,7 +130,7 @@ operation::operation(const chunk_cptr& push_data, bool minimal) NOEXCEPT
 }
 
 operation::operation(const data_slice& data) NOEXCEPT
-  : operation(stream::in::fast(data))
+  : operation(fast_reader(data))
 {
 }
 
@@ -156,11 +156,22 @@ operation::operation(reader&& source) NOEXCEPT
 {
 }
 
+// protected
+operation::operation(fast_reader&& source) NOEXCEPT
+  : operation(source)
+{
+}
+
 operation::operation(reader& source) NOEXCEPT
 {
     assign_data(source);
 }
 
+operation::operation(fast_reader& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 operation::operation(const std::string_view& mnemonic) NOEXCEPT
   : operation(from_string(mnemonic))
 {
@@ -192,9 +203,10 @@ bool operation::operator!=(const operation& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void operation::assign_data(reader& source) NOEXCEPT
+template <typename Source>
+void operation::assign_data(Source& source) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
 
     // Guard against resetting a previously-invalid stream.
     if (!source)
@@ -260,8 +272,7 @@ operation operation::from_push_data(const chunk_cptr& data,
 data_chunk operation::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out);
     return data;
 }
@@ -273,6 +284,18 @@ void operation::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void operation::to_data(writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+void operation::to_data(fast_writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+// private
+template <typename Sink>
+void operation::write_data(Sink& sink) const NOEXCEPT
 {
     // Underflow is op-undersized data, it is serialized with no opcode.
     // An underflow could only be a final token in a script deserialization.
@@ -529,21 +552,8 @@ size_t operation::serialized_size() const NOEXCEPT
 // Utilities.
 // ----------------------------------------------------------------------------
 
-// static/private
-// Advances stream, returns true unless exhausted.
-// Does not advance to end position in the case of underflow operation.
-bool operation::count_op(reader& source) NOEXCEPT
-{
-    if (source.is_exhausted())
-        return false;
-
-    const auto code = static_cast<opcode>(source.read_byte());
-    source.skip_bytes(read_data_size(code, source));
-    return true;
-}
-
-// static/private
-uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
+template <typename Source>
+static inline uint32_t push_size(opcode code, Source& source) NOEXCEPT
 {
     constexpr auto op_75 = static_cast<uint8_t>(opcode::push_size_75);
 
@@ -561,6 +571,43 @@ uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
     }
 }
 
+template <typename Source>
+static inline bool skip_op(Source& source) NOEXCEPT
+{
+    if (source.is_exhausted())
+        return false;
+
+    const auto code = static_cast<opcode>(source.read_byte());
+    source.skip_bytes(push_size(code, source));
+    return true;
+}
+
+// static/private
+// Advances stream, returns true unless exhausted.
+// Does not advance to end position in the case of underflow operation.
+bool operation::count_op(reader& source) NOEXCEPT
+{
+    return skip_op(source);
+}
+
+// static/private
+bool operation::count_op(fast_reader& source) NOEXCEPT
+{
+    return skip_op(source);
+}
+
+// static/private
+uint32_t operation::read_data_size(opcode code, reader& source) NOEXCEPT
+{
+    return push_size(code, source);
+}
+
+// static/private
+uint32_t operation::read_data_size(opcode code, fast_reader& source) NOEXCEPT
+{
+    return push_size(code, source);
+}
+
 BC_POP_WARNING()
 
 } // namespace chain
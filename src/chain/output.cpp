@@ -68,7 +68,7 @@ output::output(uint64_t value, const chain::script::cptr& script) NOEXCEPT
 }
 
 output::output(const data_slice& data) NOEXCEPT
-  : output(stream::in::fast(data))
+  : output(fast_reader(data))
 {
 }
 
@@ -94,6 +94,12 @@ output::output(reader&& source) NOEXCEPT
 {
 }
 
+// protected
+output::output(fast_reader&& source) NOEXCEPT
+  : output(source)
+{
+}
+
 output::output(reader& source) NOEXCEPT
   : value_(source.read_8_bytes_little_endian()),
     script_(CREATE(chain::script, source.get_allocator(), source, true)),
@@ -102,6 +108,14 @@ output::output(reader& source) NOEXCEPT
 {
 }
 
+output::output(fast_reader& source) NOEXCEPT
+  : value_(source.read_8_bytes_little_endian()),
+    script_(CREATE(chain::script, source.get_allocator(), source, true)),
+    valid_(source),
+    size_(serialized_size(*script_, value_))
+{
+}
+
 // protected
 output::output(uint64_t value, const chain::script::cptr& script,
     bool valid) NOEXCEPT
@@ -135,8 +149,7 @@ bool output::operator!=(const output& other) const NOEXCEPT
 data_chunk output::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out);
     return data;
 }
@@ -148,6 +161,24 @@ void output::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void output::to_data(writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+void output::to_data(fast_writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+// private
+template <typename Sink>
+void output::write_data(Sink& sink) const NOEXCEPT
+{
+    sink.write_8_bytes_little_endian(value_);
+    script_->to_data(sink, true);
+}
+
+void output::to_data(gather& sink) const NOEXCEPT
 {
     sink.write_8_bytes_little_endian(value_);
     script_->to_data(sink, true);
@@ -51,7 +51,7 @@ point::point(const hash_digest& hash, uint32_t index) NOEXCEPT
 }
 
 point::point(const data_slice& data) NOEXCEPT
-  : point(stream::in::fast(data))
+  : point(fast_reader(data))
 {
 }
 
@@ -76,11 +76,22 @@ point::point(reader&& source) NOEXCEPT
 {
 }
 
+// protected
+point::point(fast_reader&& source) NOEXCEPT
+  : point(source)
+{
+}
+
 point::point(reader& source) NOEXCEPT
 {
     assign_data(source);
 }
 
+point::point(fast_reader& source) NOEXCEPT
+{
+    assign_data(source);
+}
+
 // protected
 point::point(hash_digest&& hash, uint32_t index, bool valid) NOEXCEPT
   : hash_(std::move(hash)), index_(index), valid_(valid)
@@ -137,7 +148,8 @@ bool operator!=(const point_cref& left, const point_cref& right) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // private
-void point::assign_data(reader& source) NOEXCEPT
+template <typename Source>
+void point::assign_data(Source& source) NOEXCEPT
 {
     source.read_bytes(hash_.data(), hash_size);
     index_ = source.read_4_bytes_little_endian();
@@ -150,8 +162,7 @@ void point::assign_data(reader& source) NOEXCEPT
 data_chunk point::to_data() const NOEXCEPT
 {
     data_chunk data(serialized_size());
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out);
     return data;
 }
@@ -163,11 +174,29 @@ void point::to_data(std::ostream& stream) const NOEXCEPT
 }
 
 void point::to_data(writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+void point::to_data(fast_writer& sink) const NOEXCEPT
+{
+    write_data(sink);
+}
+
+// private
+template <typename Sink>
+void point::write_data(Sink& sink) const NOEXCEPT
 {
     sink.write_bytes(hash_);
     sink.write_4_bytes_little_endian(index_);
 }
 
+void point::to_data(gather& sink) const NOEXCEPT
+{
+    sink.reference(hash_);
+    sink.write_4_bytes_little_endian(index_);
+}
+
 // Properties.
 // ----------------------------------------------------------------------------
 
@@ -100,25 +100,31 @@ script::~script() NOEXCEPT
 {
 }
 
+// Copy/move of an unparsed script retains its bytes and remains unparsed.
 script::script(script&& other) NOEXCEPT
-  : script(
-      std::move(other.ops_),
-      other.valid_,
-      other.easier_,
-      other.failer_,
-      other.roller_,
-      other.size_)
+  : bytes_(std::move(other.bytes_)),
+    ops_(other.is_parsed() ? std::move(other.ops_) : operations{}),
+    state_(is_zero(ops_.size()) && bytes_ ? unparsed : parsed),
+    valid_(other.valid_),
+    easier_(other.easier_),
+    failer_(other.failer_),
+    roller_(other.roller_),
+    size_(other.size_),
+    offset(ops_.begin())
 {
+    other.state_.store(parsed);
 }
 
 script::script(const script& other) NOEXCEPT
-  : script(
-      other.ops_,
-      other.valid_,
-      other.easier_,
-      other.failer_,
-      other.roller_,
-      other.size_)
+  : bytes_(other.bytes_),
+    ops_(other.is_parsed() ? other.ops_ : operations{}),
+    state_(is_zero(ops_.size()) && bytes_ ? unparsed : parsed),
+    valid_(other.valid_),
+    easier_(other.easier_),
+    failer_(other.failer_),
+    roller_(other.roller_),
+    size_(other.size_),
+    offset(ops_.begin())
 {
 }
 
@@ -133,7 +139,7 @@ script::script(const operations& ops) NOEXCEPT
 }
     
 script::script(const data_slice& data, bool prefix) NOEXCEPT
-  : script(stream::in::fast(data), prefix)
+  : script(fast_reader(data), prefix)
 {
 }
 
@@ -159,8 +165,20 @@ script::script(reader&& source, bool prefix) NOEXCEPT
 {
 }
 
+// protected
+script::script(fast_reader&& source, bool prefix) NOEXCEPT
+  : script(source, prefix)
+{
+}
+
 script::script(reader& source, bool prefix) NOEXCEPT
-  : ops_(source.get_arena())
+  : bytes_(), ops_(), state_(unparsed)
+{
+    assign_data(source, prefix);
+}
+
+script::script(fast_reader& source, bool prefix) NOEXCEPT
+  : bytes_(), ops_(), state_(unparsed)
 {
     assign_data(source, prefix);
 }
@@ -173,7 +191,9 @@ script::script(const std::string_view& mnemonic, bool bitcoind) NOEXCEPT
 // protected
 script::script(const operations& ops, bool valid, bool easier, bool failer,
     bool roller, size_t size) NOEXCEPT
-  : ops_(ops),
+  : bytes_(),
+    ops_(ops),
+    state_(parsed),
     valid_(valid),
     easier_(easier),
     failer_(failer),
@@ -188,7 +208,11 @@ script::script(const operations& ops, bool valid, bool easier, bool failer,
 
 script& script::operator=(script&& other) NOEXCEPT
 {
-    ops_ = std::move(other.ops_);
+    const auto ready = other.is_parsed();
+    bytes_ = std::move(other.bytes_);
+    ops_ = ready ? std::move(other.ops_) : operations{};
+    state_.store(ready || !bytes_ ? parsed : unparsed);
+    other.state_.store(parsed);
     valid_ = other.valid_;
     easier_ = other.easier_;
     failer_ = other.failer_;
@@ -200,7 +224,10 @@ script& script::operator=(script&& other) NOEXCEPT
 
 script& script::operator=(const script& other) NOEXCEPT
 {
-    ops_ = other.ops_;
+    const auto ready = other.is_parsed();
+    bytes_ = other.bytes_;
+    ops_ = ready ? other.ops_ : operations{};
+    state_.store(ready || !bytes_ ? parsed : unparsed);
     valid_ = other.valid_;
     easier_ = other.easier_;
     failer_ = other.failer_;
@@ -212,8 +239,14 @@ script& script::operator=(const script& other) NOEXCEPT
 
 bool script::operator==(const script& other) const NOEXCEPT
 {
-    return size_ == other.size_
-        && ops_ == other.ops_;
+    if (size_ != other.size_)
+        return false;
+
+    // Parse is deterministic, so equal bytes implies equal operations.
+    if (!is_parsed() && !other.is_parsed())
+        return *bytes_ == *other.bytes_;
+
+    return ops() == other.ops();
 }
 
 bool script::operator!=(const script& other) const NOEXCEPT
@@ -225,7 +258,8 @@ bool script::operator!=(const script& other) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 // static/private
-size_t script::op_count(reader& source) NOEXCEPT
+template <typename Source>
+size_t script::op_count(Source& source) NOEXCEPT
 {
     // Stream errors reset by set_position so trap here.
     if (!source)
@@ -281,42 +315,98 @@ script script::from_operations(const operations& ops) NOEXCEPT
 }
 
 // private
-void script::assign_data(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+void script::assign_data(Source& source, bool prefix) NOEXCEPT
+{
+    byte_allocator& allocator = source.get_allocator();
+
+    // Operations are not parsed until accessed, only the bytes are retained.
+    // If read_bytes_raw returns nullptr invalid source is implied.
+    const auto bytes = prefix ?
+        source.read_bytes_raw(source.read_size(max_block_size)) :
+        source.read_bytes_raw();
+
+    if (is_null(bytes))
+        bytes_ = to_shared<data_chunk>();
+    else
+        bytes_.reset(POINTER(data_chunk, allocator, bytes));
+
+    size_ = bytes_->size();
+    valid_ = source;
+    assign_flags();
+    offset = ops_.begin();
+}
+
+// private
+// Computes the cached opcode flags without parsing operations.
+void script::assign_flags() NOEXCEPT
 {
     easier_ = false;
     failer_ = false;
     roller_ = false;
-    size_t expected{};
 
-    if (prefix)
-    {
-        expected = source.read_size();
-        source.set_limit(expected);
-    }
-
-    ops_.reserve(op_count(source));
-    const auto start = source.get_read_position();
+    fast_reader source(*bytes_);
 
     while (!source.is_exhausted())
     {
-        ops_.emplace_back(source);
-        const auto& op = ops_.back();
-        easier_ |= op.is_success();
-        failer_ |= op.is_invalid();
-        roller_ |= op.is_roller();
+        const auto code = static_cast<opcode>(source.read_byte());
+        const auto size = operation::read_data_size(code, source);
+
+        if (size > max_block_size)
+            source.invalidate();
+        else
+            source.skip_bytes(size);
+
+        // An underflow is the last operation and is parsed as any invalid.
+        if (!source)
+        {
+            failer_ = true;
+            return;
+        }
+
+        easier_ |= operation::is_success(code);
+        failer_ |= operation::is_invalid(code);
+        roller_ |= operation::is_roller(code);
     }
+}
+
+// private
+bool script::is_parsed() const NOEXCEPT
+{
+    return state_.load(std::memory_order_acquire) == parsed;
+}
 
-    size_ = source.get_read_position() - start;
+// private
+// Thread safe, the first caller parses and any concurrent caller waits.
+void script::parse() const NOEXCEPT
+{
+    if (is_parsed())
+        return;
 
-    if (prefix)
+    auto expected = unparsed;
+    if (!state_.compare_exchange_strong(expected, parsing,
+        std::memory_order_acq_rel))
     {
-        source.set_limit();
-        if (size_ != expected)
-            source.invalidate();
+        while (expected != parsed)
+        {
+            state_.wait(expected, std::memory_order_acquire);
+            expected = state_.load(std::memory_order_acquire);
+        }
+
+        return;
     }
 
-    valid_ = source;
+    // Operations are allocated on the default arena, as the arena of the
+    // source (such as a detached block arena) may no longer be available.
+    fast_reader source(*bytes_);
+    ops_.reserve(op_count(source));
+
+    while (!source.is_exhausted())
+        ops_.emplace_back(source);
+
     offset = ops_.begin();
+    state_.store(parsed, std::memory_order_release);
+    state_.notify_all();
 }
 
 // static/private
@@ -363,8 +453,7 @@ script script::from_string(const std::string_view& mnemonic,
 data_chunk script::to_data(bool prefix) const NOEXCEPT
 {
     data_chunk data(serialized_size(prefix));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out, prefix);
     return data;
 }
@@ -377,15 +466,49 @@ void script::to_data(std::ostream& stream, bool prefix) const NOEXCEPT
 
 // see also: subscript.to_data().
 void script::to_data(writer& sink, bool prefix) const NOEXCEPT
+{
+    write_data(sink, prefix);
+}
+
+void script::to_data(fast_writer& sink, bool prefix) const NOEXCEPT
+{
+    write_data(sink, prefix);
+}
+
+// private
+template <typename Sink>
+void script::write_data(Sink& sink, bool prefix) const NOEXCEPT
 {
     if (prefix)
         sink.write_variable(serialized_size(false));
 
+    // Unparsed bytes are unaffected by offset metadata.
+    if (!is_parsed())
+    {
+        sink.write_bytes(*bytes_);
+        return;
+    }
+
     // Data serialization is affected by offset metadata.
-    for (iterator op{ offset }; op != ops().end(); ++op)
+    for (iterator op{ offset }; op != ops_.end(); ++op)
         op->to_data(sink);
 }
 
+void script::to_data(gather& sink, bool prefix) const NOEXCEPT
+{
+    if (prefix)
+        sink.write_variable(serialized_size(false));
+
+    // Retained bytes are referenced unless offset metadata affects the data.
+    if (bytes_ && (!is_parsed() || offset == ops_.begin()))
+    {
+        sink.reference(*bytes_);
+        return;
+    }
+
+    sink.write_bytes(to_data(false));
+}
+
 std::string script::to_string(uint32_t active_flags,
     bool /* bitcoind */) const NOEXCEPT
 {
@@ -406,7 +529,7 @@ std::string script::to_string(uint32_t active_flags,
 
 void script::clear_offset() const NOEXCEPT
 {
-    offset = ops_.begin();
+    offset = ops().begin();
 }
 
 // Properties.
@@ -439,7 +562,7 @@ bool script::is_prevalid() const NOEXCEPT
 bool script::is_underflow() const NOEXCEPT
 {
     // Prefail implies an invalid code and a non-empty op stack.
-    return is_prefail() && ops_.back().is_underflow();
+    return is_prefail() && ops().back().is_underflow();
 }
 
 bool script::is_oversized() const NOEXCEPT
@@ -452,7 +575,7 @@ bool script::is_oversized() const NOEXCEPT
 // The criteria below are not comprehensive but are fast to evaluate.
 bool script::is_unspendable() const NOEXCEPT
 {
-    if (ops_.empty())
+    if (ops().empty())
         return false;
 
     const auto& code = ops_.front().code();
@@ -465,6 +588,7 @@ bool script::is_unspendable() const NOEXCEPT
 
 const operations& script::ops() const NOEXCEPT
 {
+    parse();
     return ops_;
 }
 
@@ -492,8 +616,8 @@ size_t script::serialized_size(const operations& ops) NOEXCEPT
 size_t script::serialized_size(bool prefix) const NOEXCEPT
 {
     // Recompute it serialization has been affected by offset metadata.
-    const auto size = (offset == ops_.begin()) ? size_ :
-        std::accumulate(offset, ops_.end(), zero, op_size);
+    const auto size = (!is_parsed() || offset == ops_.begin()) ? size_ :
+        std::accumulate(offset, ops_.cend(), zero, op_size);
 
     return prefix ? ceilinged_add(size, variable_size(size)) : size;
 }
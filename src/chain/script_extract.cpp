@@ -41,10 +41,14 @@ const chunk_cptr& script::witness_program() const NOEXCEPT
 
 script_version script::version() const NOEXCEPT
 {
-    if (!is_witness_program_pattern(ops()))
+    if (bytes_ ? !is_witness_program_pattern(*bytes_) :
+        !is_witness_program_pattern(ops()))
         return script_version::unversioned;
 
-    switch (ops_.front().code())
+    const auto code = bytes_ ? static_cast<opcode>(bytes_->front()) :
+        ops_.front().code();
+
+    switch (code)
     {
         case opcode::push_size_0:
             return script_version::segwit;
@@ -67,6 +71,22 @@ script_pattern script::pattern() const NOEXCEPT
 // The bip141 coinbase pattern is not tested here, must test independently.
 script_pattern script::output_pattern() const NOEXCEPT
 {
+    // Common patterns are matched without parsing a deserialized script.
+    if (bytes_)
+    {
+        if (is_pay_key_hash_pattern(*bytes_))
+            return script_pattern::pay_key_hash;
+
+        if (is_pay_script_hash_pattern(*bytes_))
+            return script_pattern::pay_script_hash;
+
+        if (is_pay_witness_key_hash_pattern(*bytes_))
+            return script_pattern::pay_witness_key_hash;
+
+        if (is_pay_witness_script_hash_pattern(*bytes_))
+            return script_pattern::pay_witness_script_hash;
+    }
+
     if (is_pay_key_hash_pattern(ops()))
         return script_pattern::pay_key_hash;
 
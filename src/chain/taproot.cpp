@@ -19,6 +19,7 @@
 #include <bitcoin/system/chain/taproot.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/tapscript.hpp>
@@ -79,6 +80,72 @@ hash_digest taproot::tweak_hash(const ec_xonly& key,
     return out;
 }
 
+// Batch.
+// ----------------------------------------------------------------------------
+// Tagged hashes of two 32 byte values are one block beyond the tag midstate.
+
+hashes taproot::merkle_roots(const commitments& batch) NOEXCEPT
+{
+    constexpr auto midstate = hash::sha256t::fast<"TapBranch">::midstate();
+
+    size_t depth{};
+    hashes roots(batch.size());
+    for (size_t index{}; index < batch.size(); ++index)
+    {
+        roots.at(index) = batch.at(index).leaf;
+        depth = std::max(depth, batch.at(index).control.count());
+    }
+
+    std_vector<size_t> paths{};
+    std_vector<data_array<two * hash_size>> pairs{};
+    sha256::slices_t messages{};
+
+    // Each branch hash depends on the one below it in the same path, so paths
+    // are hashed in parallel by level (paths shorter than a level drop out).
+    for (size_t level{}; level < depth; ++level)
+    {
+        paths.clear();
+        pairs.clear();
+        messages.clear();
+
+        for (size_t index{}; index < batch.size(); ++index)
+        {
+            const auto& control = batch.at(index).control;
+            if (level < control.count())
+            {
+                const auto& left = roots.at(index);
+                const auto& right = control.keys().at(level);
+                paths.push_back(index);
+                pairs.push_back(std::lexicographical_compare(left.begin(),
+                    left.end(), right.begin(), right.end()) ?
+                    splice(left, right) : splice(right, left));
+            }
+        }
+
+        // Slices are taken once pairs is no longer subject to reallocation.
+        messages.assign(pairs.begin(), pairs.end());
+        const auto branches = sha256::hash_batch(midstate, one, messages);
+        for (size_t path{}; path < paths.size(); ++path)
+            roots.at(paths.at(path)) = branches.at(path);
+    }
+
+    return roots;
+}
+
+hashes taproot::tweak_hashes(const commitments& batch,
+    const hashes& roots) NOEXCEPT
+{
+    constexpr auto midstate = hash::sha256t::fast<"TapTweak">::midstate();
+
+    std_vector<data_array<two * hash_size>> pairs{};
+    pairs.reserve(batch.size());
+    for (size_t index{}; index < batch.size(); ++index)
+        pairs.push_back(splice(batch.at(index).control.key(), roots.at(index)));
+
+    const sha256::slices_t messages(pairs.begin(), pairs.end());
+    return sha256::hash_batch(midstate, one, messages);
+}
+
 // public
 // ----------------------------------------------------------------------------
 
@@ -114,6 +181,25 @@ bool taproot::verify_commit(const tapscript& control, const ec_xonly& out_key,
     return verify_commitment(control.key(), tweak, out_key, control.parity());
 }
 
+size_t taproot::verify_commits(const commitments& batch) NOEXCEPT
+{
+    const auto tweaks = tweak_hashes(batch, merkle_roots(batch));
+    const auto invalid = [&](const commitment& item) NOEXCEPT
+    {
+        const auto& tweak = tweaks.at(possible_narrow_sign_cast<size_t>(
+            std::distance(batch.data(), &item)));
+
+        return !schnorr::verify_commitment(item.control.key(), tweak,
+            item.out_key, item.control.parity());
+    };
+
+    // The lowest invalid index is found, work beyond it is abandoned.
+    const auto it = std::find_if(poolstl::execution::par, batch.begin(),
+        batch.end(), invalid);
+
+    return possible_narrow_sign_cast<size_t>(std::distance(batch.begin(), it));
+}
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
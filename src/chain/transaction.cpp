@@ -75,7 +75,7 @@ transaction::transaction(uint32_t version, const inputs_cptr& inputs,
 }
 
 transaction::transaction(const data_slice& data, bool witness) NOEXCEPT
-  : transaction(stream::in::fast(data), witness)
+  : transaction(fast_reader(data), witness)
 {
 }
 
@@ -101,6 +101,12 @@ transaction::transaction(reader&& source, bool witness) NOEXCEPT
 {
 }
 
+// protected
+transaction::transaction(fast_reader&& source, bool witness) NOEXCEPT
+  : transaction(source, witness)
+{
+}
+
 transaction::transaction(reader& source, bool witness) NOEXCEPT
   : version_(source.read_4_bytes_little_endian()),
     inputs_(CREATE(input_cptrs, source.get_allocator())),
@@ -109,6 +115,14 @@ transaction::transaction(reader& source, bool witness) NOEXCEPT
     assign_data(source, witness);
 }
 
+transaction::transaction(fast_reader& source, bool witness) NOEXCEPT
+  : version_(source.read_4_bytes_little_endian()),
+    inputs_(CREATE(input_cptrs, source.get_allocator())),
+    outputs_(CREATE(output_cptrs, source.get_allocator()))
+{
+    assign_data(source, witness);
+}
+
 // protected
 transaction::transaction(uint32_t version,
     const chain::inputs_cptr& inputs, const chain::outputs_cptr& outputs,
@@ -147,9 +161,10 @@ bool transaction::operator!=(const transaction& other) const NOEXCEPT
 
 // private
 BC_PUSH_WARNING(NO_UNGUARDED_POINTERS)
-void transaction::assign_data(reader& source, bool witness) NOEXCEPT
+template <typename Source>
+void transaction::assign_data(Source& source, bool witness) NOEXCEPT
 {
-    auto& allocator = source.get_allocator();
+    byte_allocator& allocator = source.get_allocator();
     auto ins = to_non_const_raw_ptr(inputs_);
     auto count = source.read_size(max_block_size);
     ins->reserve(count);
@@ -216,8 +231,7 @@ data_chunk transaction::to_data(bool witness) const NOEXCEPT
     witness &= segregated_;
 
     data_chunk data(serialized_size(witness));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out, witness);
     return data;
 }
@@ -231,6 +245,18 @@ void transaction::to_data(std::ostream& stream, bool witness) const NOEXCEPT
 }
 
 void transaction::to_data(writer& sink, bool witness) const NOEXCEPT
+{
+    write_data(sink, witness);
+}
+
+void transaction::to_data(fast_writer& sink, bool witness) const NOEXCEPT
+{
+    write_data(sink, witness);
+}
+
+// private
+template <typename Sink>
+void transaction::write_data(Sink& sink, bool witness) const NOEXCEPT
 {
     witness &= segregated_;
 
@@ -257,6 +283,39 @@ void transaction::to_data(writer& sink, bool witness) const NOEXCEPT
     sink.write_4_bytes_little_endian(locktime_);
 }
 
+// Witness segments are tagged for exclusion from the nominal selection.
+void transaction::to_data(gather& sink) const NOEXCEPT
+{
+    sink.write_4_bytes_little_endian(version_);
+
+    if (segregated_)
+    {
+        sink.set_witness(true);
+        sink.write_byte(witness_marker);
+        sink.write_byte(witness_enabled);
+        sink.set_witness(false);
+    }
+
+    sink.write_variable(inputs_->size());
+    for (const auto& input: *inputs_)
+        input->to_data(sink);
+
+    sink.write_variable(outputs_->size());
+    for (const auto& output: *outputs_)
+        output->to_data(sink);
+
+    if (segregated_)
+    {
+        sink.set_witness(true);
+        for (auto& input: *inputs_)
+            input->witness().to_data(sink, true);
+
+        sink.set_witness(false);
+    }
+
+    sink.write_4_bytes_little_endian(locktime_);
+}
+
 // static/private
 transaction::sizes transaction::serialized_size(const input_cptrs& inputs,
     const output_cptrs& outputs, bool segregated) NOEXCEPT
@@ -934,7 +993,25 @@ code transaction::connect_input(const context& ctx,
     }
 
     // Evaluate non-rolling scripts with constant search but linear erase.
-    return interpreter<contiguous_stack>::connect(ctx, *this, it);
+    // The flat stack places elements and computed chunks in a single arena.
+    return interpreter<flat_stack>::connect(ctx, *this, it);
+}
+
+code transaction::connect_input(const context& ctx, const input_iterator& it,
+    machine::signature_batch& batch) const NOEXCEPT
+{
+    using namespace machine;
+
+    // TODO: evaluate performance tradeoff.
+    if ((*it)->is_roller())
+    {
+        // Evaluate rolling scripts with linear search but constant erase.
+        return interpreter<linked_stack>::connect(ctx, *this, it, batch);
+    }
+
+    // Evaluate non-rolling scripts with constant search but linear erase.
+    // The flat stack places elements and computed chunks in a single arena.
+    return interpreter<flat_stack>::connect(ctx, *this, it, batch);
 }
 
 // Connect (contextual).
@@ -944,17 +1021,94 @@ code transaction::connect_input(const context& ctx,
 
 // forks
 
-code transaction::connect(const context& ctx) const NOEXCEPT
+// Concurrency is by input, and only once signature hashing cannot populate a
+// shared cache (all prevouts populated), otherwise inputs are connected
+// serially. Concurrency assumes no prevout is shared by inputs (see script
+// offset), which is assured by check() (is_internal_double_spend).
+code transaction::connect(const context& ctx, bool concurrent) const NOEXCEPT
 {
     ////BC_ASSERT(!is_coinbase());
 
     if (is_coinbase())
         return error::transaction_success;
 
+    // Signature hash components shared by inputs are computed once.
+    set_sighash_precompute();
+
+    if (!concurrent || is_one(inputs_->size()) || !is_sighash_complete())
+    {
+        for (auto in = inputs_->begin(); in != inputs_->end(); ++in)
+            if (const auto ec = connect_input(ctx, in))
+                return ec;
+
+        return error::transaction_success;
+    }
+
+    const auto failed = [this, &ctx](const input::cptr& input) NOEXCEPT
+    {
+        const auto index = std::distance(inputs_->data(), &input);
+        return !!connect_input(ctx, std::next(inputs_->begin(), index));
+    };
+
+    // A failure cancels connection of all subsequent (not preceding) inputs,
+    // so the first failure in input order is found, as with serial connect.
+    const auto in = std::find_if(poolstl::execution::par, inputs_->begin(),
+        inputs_->end(), failed);
+
+    // The failed input is reconnected to obtain its code (not a success path).
+    return in == inputs_->end() ? error::transaction_success :
+        connect_input(ctx, in);
+}
+
+code transaction::connect(const context& ctx,
+    machine::signature_batch& batch) const NOEXCEPT
+{
+    ////BC_ASSERT(!is_coinbase());
+
+    if (is_coinbase())
+        return error::transaction_success;
+
+    // Signature hash components shared by inputs are computed once.
+    set_sighash_precompute();
+
+    for (auto in = inputs_->begin(); in != inputs_->end(); ++in)
+        if (const auto ec = connect_input(ctx, in, batch))
+            return ec;
+
+    return error::transaction_success;
+}
+
+code transaction::connect(const context& ctx,
+    machine::script_cache& cache) const NOEXCEPT
+{
+    ////BC_ASSERT(!is_coinbase());
+
+    if (is_coinbase())
+        return error::transaction_success;
+
+    // Signature hash components are computed only if an input is executed.
+    const auto& key = get_hash(true);
+    auto precomputed = false;
+
     for (auto in = inputs_->begin(); in != inputs_->end(); ++in)
+    {
+        const auto index = input_index(in);
+
+        if (cache.exists(key, index, ctx.flags))
+            continue;
+
+        if (!precomputed)
+        {
+            set_sighash_precompute();
+            precomputed = true;
+        }
+
         if (const auto ec = connect_input(ctx, in))
             return ec;
 
+        cache.store(key, index, ctx.flags);
+    }
+
     return error::transaction_success;
 }
 
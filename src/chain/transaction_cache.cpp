@@ -18,7 +18,11 @@
  */
 #include <bitcoin/system/chain/transaction.hpp>
 
+#include <algorithm>
 #include <iterator>
+#include <memory>
+#include <bitcoin/system/chain/enums/coverage.hpp>
+#include <bitcoin/system/chain/enums/script_version.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/script.hpp>
@@ -116,6 +120,14 @@ const hash_digest& transaction::get_hash(bool witness) const NOEXCEPT
     }
 }
 
+bool transaction::has_hash(bool witness) const NOEXCEPT
+{
+    if (segregated_ && witness)
+        return witness_hash_.has_value();
+
+    return nominal_hash_.has_value();
+}
+
 // Cached signature hashing (not thead safe).
 // ----------------------------------------------------------------------------
 
@@ -181,8 +193,73 @@ hash_digest transaction::v1_only_hash_scripts() const NOEXCEPT
     return digest;
 }
 
+// Midstate of the tagged preimage prefix common to all inputs for the flag.
+// This requires ALL prevouts of the tx are populated (new in taproot).
+accumulator<sha256> transaction::v1_midstate(
+    uint8_t sighash_flags) const NOEXCEPT
+{
+    constexpr uint8_t epoch{};
+    using tagged = hash::sha256t::fast<"TapSighash">;
+    accumulator<sha256> context{ tagged::midstate(), one };
+    context.write(one, &epoch);
+    context.write(one, &sighash_flags);
+    context.write(to_little_endian(version_));
+    context.write(to_little_endian(locktime_));
+    context.write(single_hash_points());
+    context.write(single_hash_amounts());
+    context.write(single_hash_scripts());
+    context.write(single_hash_sequences());
+    context.write(single_hash_outputs());
+    return context;
+}
+
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
+void transaction::set_sighash_precompute() const NOEXCEPT
+{
+    // Versioned signature hashing is limited to witness spends.
+    if (sighash_precompute_ || !segregated_)
+        return;
+
+    const auto populated = [](const auto& input) NOEXCEPT
+    {
+        return !!input->prevout;
+    };
+
+    const auto taproot = [](const auto& input) NOEXCEPT
+    {
+        return input->prevout->script().version() == script_version::taproot;
+    };
+
+    // Version 1 midstates are computed only when required (and possible).
+    // Without taproot inputs version 1 caches are never read, so all shared
+    // caches are populated once all prevouts are populated.
+    const auto complete = std::all_of(inputs_->begin(), inputs_->end(),
+        populated);
+    const auto v1 = complete &&
+        std::any_of(inputs_->begin(), inputs_->end(), taproot);
+
+    // Populate shared hash caches (v1 only hashes set by v1_midstate).
+    set_x1_base_hash();
+    set_x2_base_hash();
+
+    accumulator<sha256> v0_all{};
+    v0_all.write(to_little_endian(version_));
+    v0_all.write(double_hash_points());
+    v0_all.write(double_hash_sequences());
+
+    sighash_precompute_ = std::make_shared<const sighash_precompute>
+    (
+        std::move(v0_all),
+        v1 ? v1_midstate(to_value(coverage::hash_default)) :
+            accumulator<sha256>{},
+        v1 ? v1_midstate(to_value(coverage::hash_all)) :
+            accumulator<sha256>{},
+        v1,
+        complete
+    );
+}
+
 void transaction::set_x1_base_hash() const NOEXCEPT
 {
     if (!x1_base_cache_)
@@ -217,6 +294,13 @@ void transaction::set_v1_only_hash() const NOEXCEPT
 
 BC_POP_WARNING()
 
+// Unversioned signature hashing does not use shared caches.
+bool transaction::is_sighash_complete() const NOEXCEPT
+{
+    return !segregated_ || (sighash_precompute_ &&
+        sighash_precompute_->complete);
+}
+
 // sha256x1 (script verson 1)
 // ----------------------------------------------------------------------------
 
@@ -56,7 +56,7 @@ hash_digest transaction::output_hash_v0(
 // bytes in the signature hash preimage serialization.
 // ****************************************************************************
 
-// NOT THREAD SAFE
+// NOT THREAD SAFE (unless set_sighash_precompute)
 // Concurrent input validation for a tx unsafe due to on-demand hash caching.
 bool transaction::version0_sighash(hash_digest& out,
     const input_iterator& input, const script& subscript, uint64_t value,
@@ -68,13 +68,21 @@ bool transaction::version0_sighash(hash_digest& out,
     const auto single = (flag == coverage::hash_single);
     const auto all = (flag == coverage::hash_all);
 
+    // Common prefix midstate is precomputed for hash_all (most common).
+    static const accumulator<sha256> initial{};
+    const auto precomputed = !anyone && all && sighash_precompute_;
+
     // Create hash writer.
     stream::out::fast stream{ out };
-    hash::sha256x2::fast sink{ stream };
+    hash::sha256x2::fast sink{ stream, precomputed ?
+        sighash_precompute_->v0_all : initial };
 
-    sink.write_4_bytes_little_endian(version_);
-    sink.write_bytes(!anyone ? double_hash_points() : null_hash);
-    sink.write_bytes(!anyone && all ? double_hash_sequences() : null_hash);
+    if (!precomputed)
+    {
+        sink.write_4_bytes_little_endian(version_);
+        sink.write_bytes(!anyone ? double_hash_points() : null_hash);
+        sink.write_bytes(!anyone && all ? double_hash_sequences() : null_hash);
+    }
 
     (*input)->point().to_data(sink);
     subscript.to_data(sink, true);
@@ -63,7 +63,7 @@ uint8_t transaction::spend_type_v1(bool annex, bool tapscript) const NOEXCEPT
     return set_right(shift_left(ext_flag), zero, annex);
 }
 
-// NOT THREAD SAFE
+// NOT THREAD SAFE (unless set_sighash_precompute with all prevouts populated)
 // Concurrent input validation for a tx unsafe due to on-demand hash caching.
 // TODO: may be more optimal to not cache single output hash as use is rare.
 bool transaction::version1_sighash(hash_digest& out,
@@ -93,26 +93,37 @@ bool transaction::version1_sighash(hash_digest& out,
     if (single && output_overflow(input_index(input)))
         return false;
 
+    // Common prefix midstates are precomputed for hash_default and hash_all.
+    using tagged = hash::sha256t::fast<"TapSighash">;
+    static const accumulator<sha256> initial{ tagged::midstate(), one };
+    const auto precomputed = !anyone && all && sighash_precompute_ &&
+        sighash_precompute_->taproot;
+
     // Create tagged hash writer.
     stream::out::fast stream{ out };
-    hash::sha256t::fast<"TapSighash"> sink{ stream };
-
-    sink.write_byte(epoch);
-    sink.write_byte(sighash_flags);
-    sink.write_4_bytes_little_endian(version_);
-    sink.write_4_bytes_little_endian(locktime_);
-
-    if (!anyone)
-    {
-        sink.write_bytes(single_hash_points());
-        sink.write_bytes(single_hash_amounts());
-        sink.write_bytes(single_hash_scripts());
-        sink.write_bytes(single_hash_sequences());
-    }
+    tagged sink{ stream, !precomputed ? initial :
+        (is_zero(sighash_flags) ? sighash_precompute_->v1_default :
+            sighash_precompute_->v1_all) };
 
-    if (all)
+    if (!precomputed)
     {
-        sink.write_bytes(single_hash_outputs());
+        sink.write_byte(epoch);
+        sink.write_byte(sighash_flags);
+        sink.write_4_bytes_little_endian(version_);
+        sink.write_4_bytes_little_endian(locktime_);
+
+        if (!anyone)
+        {
+            sink.write_bytes(single_hash_points());
+            sink.write_bytes(single_hash_amounts());
+            sink.write_bytes(single_hash_scripts());
+            sink.write_bytes(single_hash_sequences());
+        }
+
+        if (all)
+        {
+            sink.write_bytes(single_hash_outputs());
+        }
     }
 
     sink.write_byte(spend_type_v1(annex, !is_null(tapleaf)));
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <bitcoin/system/chain/enums/magic_numbers.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -63,7 +64,7 @@ witness::witness(const chunk_cptrs& stack) NOEXCEPT
 }
 
 witness::witness(const data_slice& data, bool prefix) NOEXCEPT
-  : witness(stream::in::fast(data), prefix)
+  : witness(fast_reader(data), prefix)
 {
 }
 
@@ -88,6 +89,11 @@ witness::witness(reader&& source, bool prefix) NOEXCEPT
 {
 }
 
+witness::witness(fast_reader&& source, bool prefix) NOEXCEPT
+  : witness(source, prefix)
+{
+}
+
 // protected
 witness::witness(reader& source, bool prefix) NOEXCEPT
   : stack_(source.get_arena()), annex_()
@@ -96,6 +102,13 @@ witness::witness(reader& source, bool prefix) NOEXCEPT
     assign_data(source, prefix);
 }
 
+witness::witness(fast_reader& source, bool prefix) NOEXCEPT
+  : stack_(source.get_arena()), annex_()
+{
+    // annex_ may be reconstructed, since it requires the populated stack.
+    assign_data(source, prefix);
+}
+
 witness::witness(const std::string_view& mnemonic) NOEXCEPT
   : witness(from_string(mnemonic))
 {
@@ -150,56 +163,226 @@ static inline size_t element_size(const chunk_cptr& element) NOEXCEPT
     return ceilinged_add(variable_size(size), size);
 };
 
-// static
-void witness::skip(reader& source, bool prefix) NOEXCEPT
+template <typename Source>
+static inline void skip_data(Source& source, bool prefix) NOEXCEPT
 {
     if (prefix)
     {
         const auto count = source.read_size(max_block_weight);
 
         for (size_t element{}; element < count; ++element)
-            source.read_bytes(source.read_size(max_block_weight));
+            source.skip_bytes(source.read_size(max_block_weight));
     }
     else
     {
         while (!source.is_exhausted())
-            source.read_bytes(source.read_size(max_block_weight));
+            source.skip_bytes(source.read_size(max_block_weight));
     }
 }
 
-// private
-void witness::assign_data(reader& source, bool prefix) NOEXCEPT
+// static
+void witness::skip(reader& source, bool prefix) NOEXCEPT
 {
-    size_ = zero;
-    auto& allocator = source.get_allocator();
+    skip_data(source, prefix);
+}
+
+// static
+void witness::skip(fast_reader& source, bool prefix) NOEXCEPT
+{
+    skip_data(source, prefix);
+}
 
-    const auto push_witness = [&allocator, &source, this]() NOEXCEPT
+// Deserialized elements are placed in a single buffer of the source arena,
+// in stack order, with the element objects leading their contiguous bytes.
+// Allocation beyond the buffer falls back to the source arena.
+class element_arena final
+  : public arena
+{
+public:
+    DELETE_COPY_MOVE(element_arena);
+
+    element_arena(arena* parent, size_t size) THROWS
+      : parent_(parent),
+        buffer_(is_zero(size) ? nullptr : parent->allocate(size)),
+        size_(size)
     {
-        // If read_bytes_raw returns nullptr invalid source is implied.
-        const auto size = source.read_size(max_block_weight);
-        const auto bytes = source.read_bytes_raw(size);
-        if (is_null(bytes))
-            return false;
+    }
 
-        stack_.emplace_back(POINTER(data_chunk, allocator, bytes));
-        size_ = ceilinged_add(size_, element_size(stack_.back()));
-        return true;
-    };
+    ~element_arena() NOEXCEPT override
+    {
+        if (!is_null(buffer_))
+            parent_->deallocate(buffer_, size_);
+    }
 
-    if (prefix)
+    void* start(size_t) THROWS override
     {
-        const auto count = source.read_size(max_block_weight);
-        stack_.reserve(count);
+        return nullptr;
+    }
 
-        for (size_t element{}; element < count; ++element)
-            if (!push_witness())
-                break;
+    size_t detach() NOEXCEPT override
+    {
+        return offset_;
+    }
+
+    void release(void*) NOEXCEPT override
+    {
+    }
+
+private:
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+    bool is_inline(const void* ptr) const NOEXCEPT
+    {
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+        const auto first = reinterpret_cast<uintptr_t>(buffer_);
+        return !is_null(buffer_) && address >= first && address < first + size_;
+    }
+
+    void* do_allocate(size_t bytes, size_t align) THROWS override
+    {
+        void* ptr = static_cast<uint8_t*>(buffer_) + offset_;
+        auto space = size_ - offset_;
+        if (is_null(buffer_) || is_null(std::align(align, bytes, ptr, space)))
+            return parent_->allocate(bytes, align);
+
+        offset_ = size_ - space + bytes;
+        return ptr;
+    }
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override
+    {
+        if (!is_inline(ptr))
+            parent_->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const arena& other) const NOEXCEPT override
+    {
+        return &other == this;
+    }
+
+    arena* parent_;
+    void* buffer_;
+    size_t size_;
+    size_t offset_{};
+};
+
+// Owner of all elements of a deserialized witness (elements destruct first).
+struct flat_elements
+{
+    flat_elements(arena* parent, size_t count, size_t bytes) THROWS
+      : memory(parent, ceilinged_add(bytes, count * sizeof(data_chunk))),
+        elements(&memory)
+    {
+        elements.reserve(count);
+    }
+
+    element_arena memory;
+    data_stack elements;
+};
+
+// private
+template <typename Source>
+void witness::assign_data(Source& source, bool prefix) NOEXCEPT
+{
+    size_ = zero;
+    valid_ = false;
+    byte_allocator& allocator = source.get_allocator();
+
+    // A reader may not be able to rewind (e.g. std::istream), so elements are
+    // flattened into one buffer only when reading from a contiguous buffer.
+    if constexpr (!is_same_type<Source, fast_reader>)
+    {
+        const auto push_witness = [&allocator, &source, this]() NOEXCEPT
+        {
+            // If read_bytes_raw returns nullptr invalid source is implied.
+            const auto size = source.read_size(max_block_weight);
+            const auto bytes = source.read_bytes_raw(size);
+            if (is_null(bytes))
+                return false;
+
+            stack_.emplace_back(POINTER(data_chunk, allocator, bytes));
+            size_ = ceilinged_add(size_, element_size(stack_.back()));
+            return true;
+        };
+
+        if (prefix)
+        {
+            const auto count = source.read_size(max_block_weight);
+            stack_.reserve(count);
+
+            for (size_t element{}; element < count; ++element)
+                if (!push_witness())
+                    break;
+        }
+        else
+        {
+            while (!source.is_exhausted())
+                if (!push_witness())
+                    break;
+        }
     }
     else
     {
-        while (!source.is_exhausted())
-            if (!push_witness())
-                break;
+        // Measure the stack, then rewind to place all elements in one buffer.
+        size_t count{};
+        size_t bytes{};
+        const auto measure = [&]() NOEXCEPT
+        {
+            const auto size = source.read_size(max_block_weight);
+            source.skip_bytes(size);
+            bytes = ceilinged_add(bytes, size);
+            size_ = ceilinged_add(size_,
+                ceilinged_add(variable_size(size), size));
+            ++count;
+        };
+
+        auto consumed = zero;
+        if (prefix)
+        {
+            const auto declared = source.read_size(max_block_weight);
+            consumed = variable_size(declared);
+            while (source && count < declared)
+                measure();
+        }
+        else
+        {
+            while (source && !source.is_exhausted())
+                measure();
+        }
+
+        // An invalid source implies an invalid (empty) witness.
+        if (!source)
+        {
+            size_ = zero;
+            return;
+        }
+
+        source.rewind_bytes(ceilinged_add(consumed, size_));
+        if (prefix)
+            source.read_size(max_block_weight);
+
+        if (!is_zero(count))
+        {
+            const std::shared_ptr<flat_elements> owner(CREATE(flat_elements,
+                allocator, allocator.resource(), count, bytes));
+
+            // Each element is copied from the source view (no byte fill),
+            // leaving the bytes of the elements contiguous.
+            auto& elements = owner->elements;
+            for (size_t element{}; element < count; ++element)
+            {
+                const auto slice = source.read_slice(
+                    source.read_size(max_block_weight));
+                elements.emplace_back(slice.begin(), slice.end());
+            }
+
+            // Each element aliases the owner (one control block, allocation).
+            stack_.reserve(count);
+            for (const auto& element: elements)
+                stack_.emplace_back(chunk_cptr{ owner, &element });
+        }
     }
 
     if (annex::is_annex_pattern(stack_))
@@ -214,8 +397,7 @@ void witness::assign_data(reader& source, bool prefix) NOEXCEPT
 data_chunk witness::to_data(bool prefix) const NOEXCEPT
 {
     data_chunk data(serialized_size(prefix));
-    stream::out::fast ostream(data);
-    write::bytes::fast out(ostream);
+    fast_writer out(data);
     to_data(out, prefix);
     return data;
 }
@@ -227,6 +409,18 @@ void witness::to_data(std::ostream& stream, bool prefix) const NOEXCEPT
 }
 
 void witness::to_data(writer& sink, bool prefix) const NOEXCEPT
+{
+    write_data(sink, prefix);
+}
+
+void witness::to_data(fast_writer& sink, bool prefix) const NOEXCEPT
+{
+    write_data(sink, prefix);
+}
+
+// private
+template <typename Sink>
+void witness::write_data(Sink& sink, bool prefix) const NOEXCEPT
 {
     // Witness prefix is an element count, not byte length (unlike script).
     if (prefix)
@@ -240,6 +434,18 @@ void witness::to_data(writer& sink, bool prefix) const NOEXCEPT
     }
 }
 
+void witness::to_data(gather& sink, bool prefix) const NOEXCEPT
+{
+    if (prefix)
+        sink.write_variable(stack_.size());
+
+    for (const auto& element: stack_)
+    {
+        sink.write_variable(element->size());
+        sink.reference(*element);
+    }
+}
+
 // Text.
 // ----------------------------------------------------------------------------
 
@@ -315,6 +521,11 @@ const chain::annex& witness::annex() const NOEXCEPT
     return annex_;
 }
 
+data_slice witness::element(size_t index) const NOEXCEPT
+{
+    return index < stack_.size() ? data_slice{ *stack_[index] } : data_slice{};
+}
+
 // static
 size_t witness::serialized_size(const chunk_cptrs& stack, bool prefix) NOEXCEPT
 {
@@ -166,7 +166,8 @@ code witness::extract_segwit(script::cptr& out_script,
 // All [bip341] comments.
 // Extract script, initial execution stack, and optional tapleaf hash.
 code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
-    chunk_cptrs_ptr& out_stack, const script& program_script) const NOEXCEPT
+    chunk_cptrs_ptr& out_stack, const script& program_script,
+    std::optional<taproot::commitment>* deferred) const NOEXCEPT
 {
     BC_ASSERT(program_script.version() == script_version::taproot);
     const auto& program = program_script.witness_program();
@@ -207,6 +208,16 @@ code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
                 // Execute tapleaf script.
                 // out stack  : [stack-elements]
                 // out script : (popped-from-stack)
+                if (!is_null(deferred))
+                {
+                    deferred->emplace(taproot::commitment
+                    {
+                        control, key, *out_leaf
+                    });
+
+                    return error::script_success;
+                }
+
                 return taproot::verify_commit(control, key, *out_leaf) ?
                     error::script_success : error::invalid_commitment;
             }
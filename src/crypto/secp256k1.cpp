@@ -19,6 +19,7 @@
 #include <bitcoin/system/crypto/secp256k1.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
@@ -537,6 +538,23 @@ bool verify_commitment(const ec_xonly& internal_key, const hash_digest& tweak,
             parity, &pubkey, tweak.data()) == ec_success;
 }
 
+// Schnorr batch verify
+// ----------------------------------------------------------------------------
+
+size_t verify_signatures(const verifications& batch) NOEXCEPT
+{
+    const auto invalid = [](const verification& item) NOEXCEPT
+    {
+        return !verify_signature(item.point, item.hash, item.signature);
+    };
+
+    // The lowest invalid index is found, work beyond it is abandoned.
+    const auto it = std::find_if(poolstl::execution::par, batch.begin(),
+        batch.end(), invalid);
+
+    return to_unsigned(std::distance(batch.begin(), it));
+}
+
 } // namespace schnorr
 } // namespace system
 } // namespace libbitcoin
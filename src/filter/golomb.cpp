@@ -22,6 +22,8 @@
 #include <bitcoin/system/filter/golomb.hpp>
 
 #include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -32,6 +34,13 @@
 namespace libbitcoin {
 namespace system {
 
+// Items are hashed concurrently in chunks of this count, each chunk across
+// vector lanes. Sets of one chunk or less are hashed on the calling thread.
+constexpr size_t concurrent_items = 1024;
+
+// Hashes radix sorted at or above this count, comparison sorted below.
+constexpr size_t radix_items = 64;
+
 // Golomb-coded set construction
 // ----------------------------------------------------------------------------
 
@@ -137,14 +146,12 @@ bool golomb::match_stack(bitreader& source, const data_stack& targets,
     {
         range += decode(source, bits);
 
-        for (auto value = *it; it != set.end(); value = *(it++))
-        {
-            if (value == range)
-                return true;
+        // Both sequences ascend, so advance targets to the decoded value.
+        while (it != set.end() && *it < range)
+            ++it;
 
-            if (value > range)
-                break;
-        }
+        if (it != set.end() && *it == range)
+            return true;
     }
 
     return false;
@@ -168,6 +175,32 @@ bool golomb::match_stack(const data_chunk& compressed_set,
         bits, target_false_positive_rate);
 }
 
+// Multiple set intersection match
+// ----------------------------------------------------------------------------
+
+std::vector<bool> golomb::match_many(const compressed_sets& sets,
+    const data_stack& targets, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    // Duplicate targets would otherwise be hashed once for each set.
+    auto unique = targets;
+    std::sort(unique.begin(), unique.end());
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+
+    // std::vector<bool> elements cannot be written concurrently.
+    std_vector<uint8_t> matches(sets.size());
+    std::transform(poolstl::execution::par, sets.begin(), sets.end(),
+        matches.begin(), [&](const compressed_set& set) NOEXCEPT
+        {
+            stream::in::fast source(set.set);
+            read::bits::fast reader(source);
+            return to_int<uint8_t>(match_stack(reader, unique, set.set_size,
+                set.entropy, bits, target_false_positive_rate));
+        });
+
+    return { matches.begin(), matches.end() };
+}
+
 // private
 // ----------------------------------------------------------------------------
 
@@ -194,9 +227,14 @@ uint64_t golomb::decode(bitreader& reader, uint8_t modulo_exponent) NOEXCEPT
 
 uint64_t golomb::hash_to_range(const data_slice& item, uint64_t bound,
     const siphash_key& key) NOEXCEPT
+{
+    return to_range(siphash(key, item), bound);
+}
+
+uint64_t golomb::to_range(uint64_t hash, uint64_t bound) NOEXCEPT
 {
     constexpr auto shift = bits<uint64_t>;
-    const auto product = uint128_t(siphash(key, item)) * uint128_t(bound);
+    const auto product = uint128_t(hash) * uint128_t(bound);
     return (product >> shift).convert_to<uint64_t>();
 }
 
@@ -207,17 +245,74 @@ std::vector<uint64_t> golomb::hashed_set_construct(const data_stack& items,
     if (is_multiply_overflow(target_false_positive_rate, set_size))
         return {};
 
-    std::vector<uint64_t> hashes(items.size());
+    const auto count = items.size();
     const auto bound = target_false_positive_rate * set_size;
-    std::transform(items.begin(), items.end(), hashes.begin(),
-        [&](const data_chunk& item) NOEXCEPT
+    std::vector<uint64_t> hashes(count);
+    std_vector<size_t> chunks(ceilinged_divide(count, concurrent_items));
+    std::iota(chunks.begin(), chunks.end(), zero);
+
+    const auto concurrent = chunks.size() > one;
+    std::for_each(poolstl::execution::par_if(concurrent), chunks.begin(),
+        chunks.end(), [&](size_t chunk) NOEXCEPT
         {
-            return hash_to_range(item, bound, key);
+            const auto first = chunk * concurrent_items;
+            const auto last = std::min(count, first + concurrent_items);
+            const std::vector<data_slice> slices(std::next(items.begin(),
+                first), std::next(items.begin(), last));
+
+            const auto sips = siphash_batch(key, slices);
+            for (size_t index = 0; index < sips.size(); ++index)
+                hashes.at(first + index) = to_range(sips.at(index), bound);
         });
 
-    return sort(std::move(hashes));
+    if (hashes.size() < radix_items)
+        return sort(std::move(hashes));
+
+    radix_sort(hashes, bound);
+    return hashes;
+}
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Least significant digit first, one pass per significant byte of the bound
+// (hashes are less than bound), skipping passes with a single digit value.
+void golomb::radix_sort(std::vector<uint64_t>& values, uint64_t bound) NOEXCEPT
+{
+    constexpr auto radix = add1(size_t{ max_uint8 });
+    std_array<size_t, radix> counts{};
+    std::vector<uint64_t> buffer(values.size());
+
+    for (size_t byte = 0; byte < byte_width(bound); ++byte)
+    {
+        const auto shift = to_bits(byte);
+        const auto digit = [shift](uint64_t value) NOEXCEPT
+        {
+            return narrow_cast<uint8_t>(shift_right(value, shift));
+        };
+
+        counts.fill(zero);
+        for (const auto value: values)
+            ++counts[digit(value)];
+
+        if (counts[digit(values.front())] == values.size())
+            continue;
+
+        // Exclusive prefix sum converts counts to bucket offsets.
+        size_t offset = zero;
+        for (auto& count: counts)
+            count = std::exchange(offset, offset + count);
+
+        for (const auto value: values)
+            buffer[counts[digit(value)]++] = value;
+
+        std::swap(values, buffer);
+    }
 }
 
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 
 } // namespace system
 } // namespace libbitcoin
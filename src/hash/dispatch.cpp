@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/hash/sha/dispatch.hpp>
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/sha/algorithm.hpp>
+#include "kernels.hpp"
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+// Portable kernels are compiled for the library instruction set.
+constexpr kernels portable
+{
+    kernel::portable, &kernel_algorithm::iterate,
+    kernel::portable, &kernel_algorithm::merkle,
+    kernel::portable, &kernel_algorithm::batch,
+    kernel::portable, &rmd_kernel_algorithm::halves,
+    &rmd_kernel_algorithm::batch,
+    kernel::portable, &sip_batch
+};
+
+kernels dispatch(kernel set) NOEXCEPT
+{
+#if defined(HAVE_DISPATCH)
+    switch (set)
+    {
+        case kernel::native:
+            if (try_shani())
+                return
+                {
+                    kernel::native, &iterate_native,
+                    kernel::native, &merkle_native,
+                    kernel::native, &batch_native,
+                    kernel::native, &rmd_halves_native, &rmd_batch_native,
+                    kernel::native, &sip_batch_native
+                };
+            break;
+        case kernel::avx512:
+            if (try_avx512())
+                return
+                {
+                    kernel::avx512, &iterate_avx512,
+                    kernel::avx512, &merkle_avx512,
+                    kernel::avx512, &batch_avx512,
+                    kernel::avx512, &rmd_halves_avx512, &rmd_batch_avx512,
+                    kernel::avx512, &sip_batch_avx512
+                };
+            break;
+        case kernel::avx2:
+            if (try_avx2())
+                return
+                {
+                    kernel::avx2, &iterate_avx2,
+                    kernel::avx2, &merkle_avx2,
+                    kernel::avx2, &batch_avx2,
+                    kernel::avx2, &rmd_halves_avx2, &rmd_batch_avx2,
+                    kernel::avx2, &sip_batch_avx2
+                };
+            break;
+        case kernel::portable:
+        default:
+            break;
+    }
+#else
+    std::ignore = set;
+#endif // HAVE_DISPATCH
+
+    return portable;
+}
+
+// local
+static kernels select() NOEXCEPT
+{
+    auto out = portable;
+
+    // Iteration in ascending order of preference.
+    for (const auto set: { kernel::avx2, kernel::avx512, kernel::native })
+    {
+        const auto found = dispatch(set);
+        if (found.iterate_set != kernel::portable)
+        {
+            out.iterate_set = found.iterate_set;
+            out.iterate = found.iterate;
+        }
+    }
+
+    // Merkle and batch (lanes) in ascending order of preference.
+    for (const auto set: { kernel::avx2, kernel::native, kernel::avx512 })
+    {
+        const auto found = dispatch(set);
+        if (found.merkle_set != kernel::portable)
+        {
+            out.merkle_set = found.merkle_set;
+            out.merkle = found.merkle;
+            out.batch_set = found.batch_set;
+            out.batch = found.batch;
+        }
+    }
+
+    // rmd160 and siphash (lanes only) in ascending order of preference.
+    for (const auto set: { kernel::native, kernel::avx2, kernel::avx512 })
+    {
+        const auto found = dispatch(set);
+        if (found.rmd_set != kernel::portable)
+        {
+            out.rmd_set = found.rmd_set;
+            out.rmd_halves = found.rmd_halves;
+            out.rmd_batch = found.rmd_batch;
+            out.sip_set = found.sip_set;
+            out.sip_batch = found.sip_batch;
+        }
+    }
+
+    return out;
+}
+
+const kernels& dispatch() NOEXCEPT
+{
+    static const auto selected = select();
+    return selected;
+}
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
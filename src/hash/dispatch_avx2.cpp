@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "kernels.hpp"
+
+#include <bitcoin/system/define.hpp>
+
+// Compiled with -mavx -mavx2 -fno-weak (only) when HAVE_DISPATCH.
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+#if defined(HAVE_DISPATCH)
+
+static_assert(have_256, "dispatch_avx2.cpp requires -mavx -mavx2");
+
+void iterate_avx2(kernels::state_t& state, size_t blocks,
+    const uint8_t* data) NOEXCEPT
+{
+    kernel_algorithm::iterate(state, blocks, data);
+}
+
+void merkle_avx2(uint8_t* data, size_t pairs) NOEXCEPT
+{
+    kernel_algorithm::merkle(data, pairs);
+}
+
+void batch_avx2(kernels::digests_t& digests,
+    const kernels::state_t& midstate, size_t prefix,
+    const kernels::slices_t& messages, bool double_hash) NOEXCEPT
+{
+    kernel_algorithm::batch(digests, midstate, prefix, messages, double_hash);
+}
+
+void rmd_halves_avx2(kernels::short_digests_t& digests,
+    const kernels::halves_t& halves) NOEXCEPT
+{
+    rmd_kernel_algorithm::halves(digests, halves);
+}
+
+void rmd_batch_avx2(kernels::short_digests_t& digests,
+    const kernels::slices_t& messages) NOEXCEPT
+{
+    rmd_kernel_algorithm::batch(digests, messages);
+}
+
+void sip_batch_avx2(kernels::sip_hashes_t& hashes,
+    const kernels::sip_key_t& key, const kernels::slices_t& messages) NOEXCEPT
+{
+    sip_batch(hashes, key, messages);
+}
+
+#endif // HAVE_DISPATCH
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_KERNELS_HPP
+#define LIBBITCOIN_SYSTEM_HASH_KERNELS_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/rmd/algorithm.hpp>
+#include <bitcoin/system/hash/sha/algorithm.hpp>
+#include <bitcoin/system/hash/sha/dispatch.hpp>
+#include "sip_lanes.hpp"
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+/// Kernels, each defined in a translation unit compiled for its instruction
+/// set (dispatch_avx2.cpp, dispatch_avx512.cpp, dispatch_native.cpp).
+/// ---------------------------------------------------------------------------
+
+#if defined(HAVE_DISPATCH)
+void iterate_avx2(kernels::state_t& state, size_t blocks,
+    const uint8_t* data) NOEXCEPT;
+void merkle_avx2(uint8_t* data, size_t pairs) NOEXCEPT;
+void batch_avx2(kernels::digests_t& digests,
+    const kernels::state_t& midstate, size_t prefix,
+    const kernels::slices_t& messages, bool double_hash) NOEXCEPT;
+void rmd_halves_avx2(kernels::short_digests_t& digests,
+    const kernels::halves_t& halves) NOEXCEPT;
+void rmd_batch_avx2(kernels::short_digests_t& digests,
+    const kernels::slices_t& messages) NOEXCEPT;
+void sip_batch_avx2(kernels::sip_hashes_t& hashes,
+    const kernels::sip_key_t& key, const kernels::slices_t& messages) NOEXCEPT;
+
+void iterate_avx512(kernels::state_t& state, size_t blocks,
+    const uint8_t* data) NOEXCEPT;
+void merkle_avx512(uint8_t* data, size_t pairs) NOEXCEPT;
+void batch_avx512(kernels::digests_t& digests,
+    const kernels::state_t& midstate, size_t prefix,
+    const kernels::slices_t& messages, bool double_hash) NOEXCEPT;
+void rmd_halves_avx512(kernels::short_digests_t& digests,
+    const kernels::halves_t& halves) NOEXCEPT;
+void rmd_batch_avx512(kernels::short_digests_t& digests,
+    const kernels::slices_t& messages) NOEXCEPT;
+void sip_batch_avx512(kernels::sip_hashes_t& hashes,
+    const kernels::sip_key_t& key, const kernels::slices_t& messages) NOEXCEPT;
+
+void iterate_native(kernels::state_t& state, size_t blocks,
+    const uint8_t* data) NOEXCEPT;
+void merkle_native(uint8_t* data, size_t pairs) NOEXCEPT;
+void batch_native(kernels::digests_t& digests,
+    const kernels::state_t& midstate, size_t prefix,
+    const kernels::slices_t& messages, bool double_hash) NOEXCEPT;
+void rmd_halves_native(kernels::short_digests_t& digests,
+    const kernels::halves_t& halves) NOEXCEPT;
+void rmd_batch_native(kernels::short_digests_t& digests,
+    const kernels::slices_t& messages) NOEXCEPT;
+void sip_batch_native(kernels::sip_hashes_t& hashes,
+    const kernels::sip_key_t& key, const kernels::slices_t& messages) NOEXCEPT;
+#endif // HAVE_DISPATCH
+
+/// Kernel implementation, instantiated by each including translation unit.
+/// ---------------------------------------------------------------------------
+/// This unpublished header gives each instantiation internal linkage, so that
+/// code compiled for one instruction set cannot be merged into another. This
+/// also precludes dispatch recursion, as only h256<> and h160<> are
+/// dispatched. Other inline definitions (library, boost, std) emitted by a
+/// kernel translation unit are given internal linkage by compiling it with
+/// -fno-weak. The dispatch symbols test (make check, ctest) fails the build
+/// if a kernel object defines any other external code symbol.
+
+namespace {
+
+struct h256_kernel
+  : public h256<>
+{
+};
+
+class kernel_algorithm
+  : public algorithm<h256_kernel>
+{
+public:
+    static_assert(is_same_type<digests_t, kernels::digests_t>);
+    static_assert(is_same_type<slices_t, kernels::slices_t>);
+
+    static void iterate(kernels::state_t& state, size_t blocks,
+        const uint8_t* data) NOEXCEPT
+    {
+        accumulate(state, iblocks_t{ blocks * array_count<block_t>, data });
+    }
+
+    static void merkle(uint8_t* data, size_t pairs) NOEXCEPT
+    {
+        auto iblocks = iblocks_t{ pairs * array_count<block_t>, data };
+        auto idigests = idigests_t{ pairs * array_count<digest_t>, data };
+
+        // Always use if available.
+        merkle_hash_vector<xint512_t>(idigests, iblocks);
+
+        // Only use if shani is not available.
+        if constexpr (!native)
+        {
+            merkle_hash_vector<xint256_t>(idigests, iblocks);
+            merkle_hash_vector<xint128_t>(idigests, iblocks);
+        }
+
+        // Complete pairs using native/normal form (digests trail blocks).
+        for (; !iblocks.empty(); iblocks.advance())
+        {
+            idigests.to_array<one>().front() =
+                double_hash(iblocks.to_array().front());
+            idigests.advance<one>();
+        }
+    }
+
+    static void batch(kernels::digests_t& digests,
+        const kernels::state_t& midstate, size_t prefix,
+        const kernels::slices_t& messages, bool double_hash) NOEXCEPT
+    {
+        digests = double_hash ?
+            algorithm::batch<true>(midstate, prefix, messages) :
+            algorithm::batch<false>(midstate, prefix, messages);
+    }
+};
+
+// siphash lanes (sip_batch) have internal linkage through sip_lanes.hpp.
+static_assert(is_same_type<siphash_key, kernels::sip_key_t>);
+
+struct h160_kernel
+  : public rmd::h160<>
+{
+};
+
+class rmd_kernel_algorithm
+  : public rmd::algorithm<h160_kernel>
+{
+public:
+    static_assert(is_same_type<digests_t, kernels::short_digests_t>);
+    static_assert(is_same_type<halves_t, kernels::halves_t>);
+    static_assert(is_same_type<slices_t, kernels::slices_t>);
+
+    static void halves(kernels::short_digests_t& digests,
+        const kernels::halves_t& halves) NOEXCEPT
+    {
+        digests = hash_batch(halves);
+    }
+
+    static void batch(kernels::short_digests_t& digests,
+        const kernels::slices_t& messages) NOEXCEPT
+    {
+        digests = hash_batch(messages);
+    }
+};
+
+} // namespace
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SIP_LANES_HPP
+#define LIBBITCOIN_SYSTEM_HASH_SIP_LANES_HPP
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/siphash.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// siphash lanes, instantiated by each including translation unit.
+/// ---------------------------------------------------------------------------
+/// This unpublished header gives each instantiation internal linkage, so that
+/// code compiled for one instruction set cannot be merged into another
+/// (siphash.cpp and the kernel translation units, see kernels.hpp).
+
+namespace {
+
+constexpr uint64_t siphash_magic_0 = 0x736f6d6570736575;
+constexpr uint64_t siphash_magic_1 = 0x646f72616e646f6d;
+constexpr uint64_t siphash_magic_2 = 0x6c7967656e657261;
+constexpr uint64_t siphash_magic_3 = 0x7465646279746573;
+constexpr uint64_t finalization = 0x00000000000000ff;
+constexpr uint64_t max_encoded_byte_count = (1 << byte_bits);
+
+// Batch hashing (independent messages striped across vector lanes).
+// ============================================================================
+// Each lane carries one message. Messages are ordered by compression word
+// count so that lanes of a set complete together. A lane that completes early
+// retains a copy of its state, and subsequent rounds in that lane are waste.
+// Finalization rounds are common to all lanes.
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+template <typename xWord>
+constexpr auto sip_lanes = capacity<xWord, uint64_t>;
+
+template <typename xWord>
+using sip_words_t = std_array<uint64_t, sip_lanes<xWord>>;
+
+// local
+constexpr size_t sip_words(size_t bytes) NOEXCEPT
+{
+    // Whole words and the length-tagged remainder word.
+    return add1(bytes / sizeof(uint64_t));
+}
+
+// local
+INLINE uint64_t sip_word(const data_slice& message, size_t index) NOEXCEPT
+{
+    constexpr auto eight = sizeof(uint64_t);
+    const auto bytes = message.size();
+    const auto start = index * eight;
+
+    if ((start + eight) <= bytes)
+        return unsafe_from_little_endian<uint64_t>(&message.data()[start]);
+
+    // Zero to seven remainder bytes (zero padded), tagged with length.
+    data_array<eight> last{};
+    std::copy_n(&message.data()[start], bytes - start, last.begin());
+    return from_little_endian(last) ^
+        ((bytes % max_encoded_byte_count) << to_bits(sub1(eight)));
+}
+
+// local
+template <typename xWord>
+INLINE void sip_round(xWord& v0, xWord& v1, xWord& v2, xWord& v3) NOEXCEPT
+{
+    constexpr auto s = bits<uint64_t>;
+
+    v0 = f::add<s>(v0, v1);
+    v2 = f::add<s>(v2, v3);
+    v1 = f::rol<13, s>(v1);
+    v3 = f::rol<16, s>(v3);
+    v1 = f::xor_(v1, v0);
+    v3 = f::xor_(v3, v2);
+
+    v0 = f::rol<32, s>(v0);
+
+    v2 = f::add<s>(v2, v1);
+    v0 = f::add<s>(v0, v3);
+    v1 = f::rol<17, s>(v1);
+    v3 = f::rol<21, s>(v3);
+    v1 = f::xor_(v1, v2);
+    v3 = f::xor_(v3, v0);
+
+    v2 = f::rol<32, s>(v2);
+}
+
+// local
+template <typename xWord>
+INLINE xWord sip_pack(const sip_words_t<xWord>& words) NOEXCEPT
+{
+    if constexpr (sip_lanes<xWord> == 2)
+    {
+        return f::set<xWord>(
+            words[0], words[1]);
+    }
+    else if constexpr (sip_lanes<xWord> == 4)
+    {
+        return f::set<xWord>(
+            words[0], words[1], words[2], words[3]);
+    }
+    else if constexpr (sip_lanes<xWord> == 8)
+    {
+        return f::set<xWord>(
+            words[0], words[1], words[2], words[3],
+            words[4], words[5], words[6], words[7]);
+    }
+}
+
+// local
+template <typename xWord>
+INLINE void sip_unpack(sip_words_t<xWord>& words, xWord value) NOEXCEPT
+{
+    words[0] = f::get<uint64_t, 0>(value);
+    words[1] = f::get<uint64_t, 1>(value);
+
+    if constexpr (sip_lanes<xWord> >= 4)
+    {
+        words[2] = f::get<uint64_t, 2>(value);
+        words[3] = f::get<uint64_t, 3>(value);
+    }
+
+    if constexpr (sip_lanes<xWord> >= 8)
+    {
+        words[4] = f::get<uint64_t, 4>(value);
+        words[5] = f::get<uint64_t, 5>(value);
+        words[6] = f::get<uint64_t, 6>(value);
+        words[7] = f::get<uint64_t, 7>(value);
+    }
+}
+
+// local
+template <typename xWord, if_extended<xWord> = true>
+INLINE void sip_vector(std::vector<uint64_t>& hashes, const siphash_key& key,
+    const std::vector<data_slice>& messages, const std::vector<size_t>& order,
+    size_t& next) NOEXCEPT
+{
+    constexpr auto lanes = sip_lanes<xWord>;
+
+    if constexpr (have<xWord>)
+    {
+        if ((messages.size() - next) >= lanes)
+        {
+            const auto k0 = std::get<0>(key);
+            const auto k1 = std::get<1>(key);
+            const auto i0 = f::broadcast<xWord>(siphash_magic_0 ^ k0);
+            const auto i1 = f::broadcast<xWord>(siphash_magic_1 ^ k1);
+            const auto i2 = f::broadcast<xWord>(siphash_magic_2 ^ k0);
+            const auto i3 = f::broadcast<xWord>(siphash_magic_3 ^ k1);
+            const auto finalize = f::broadcast<xWord>(finalization);
+
+            std_array<size_t, lanes> counts{};
+            sip_words_t<xWord> words{};
+            std_array<sip_words_t<xWord>, 4> states{};
+            std_array<sip_words_t<xWord>, 4> lanes_state{};
+
+            do
+            {
+                const auto set = &order.data()[next];
+
+                // Set is ordered by word count, so last lane is the longest.
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    counts[lane] = sip_words(messages[set[lane]].size());
+
+                auto v0 = i0;
+                auto v1 = i1;
+                auto v2 = i2;
+                auto v3 = i3;
+
+                for (size_t index = 0; index < counts.back(); ++index)
+                {
+                    // Completed lanes retain stale words (waste is ignored).
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        if (index < counts[lane])
+                            words[lane] = sip_word(messages[set[lane]], index);
+
+                    const auto word = sip_pack<xWord>(words);
+                    v3 = f::xor_(v3, word);
+                    sip_round(v0, v1, v2, v3);
+                    sip_round(v0, v1, v2, v3);
+                    v0 = f::xor_(v0, word);
+
+                    // Capture state of each lane completed here.
+                    if (std::find(counts.begin(), counts.end(), add1(index)) ==
+                        counts.end())
+                        continue;
+
+                    sip_unpack<xWord>(lanes_state[0], v0);
+                    sip_unpack<xWord>(lanes_state[1], v1);
+                    sip_unpack<xWord>(lanes_state[2], v2);
+                    sip_unpack<xWord>(lanes_state[3], v3);
+
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        if (counts[lane] == add1(index))
+                        {
+                            states[0][lane] = lanes_state[0][lane];
+                            states[1][lane] = lanes_state[1][lane];
+                            states[2][lane] = lanes_state[2][lane];
+                            states[3][lane] = lanes_state[3][lane];
+                        }
+                    }
+                }
+
+                v0 = sip_pack<xWord>(states[0]);
+                v1 = sip_pack<xWord>(states[1]);
+                v2 = f::xor_(sip_pack<xWord>(states[2]), finalize);
+                v3 = sip_pack<xWord>(states[3]);
+
+                sip_round(v0, v1, v2, v3);
+                sip_round(v0, v1, v2, v3);
+                sip_round(v0, v1, v2, v3);
+                sip_round(v0, v1, v2, v3);
+
+                sip_unpack<xWord>(words,
+                    f::xor_(f::xor_(v0, v1), f::xor_(v2, v3)));
+
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    hashes[set[lane]] = words[lane];
+
+                next += lanes;
+            }
+            while ((messages.size() - next) >= lanes);
+        }
+    }
+}
+
+// local
+inline void sip_batch(std::vector<uint64_t>& hashes, const siphash_key& key,
+    const std::vector<data_slice>& messages) NOEXCEPT
+{
+    const auto count = messages.size();
+    hashes.resize(count);
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), zero);
+
+    if constexpr (have_128 || have_256 || have_512)
+    {
+        // Stable so that equal word counts retain message order.
+        std::stable_sort(order.begin(), order.end(),
+            [&](size_t left, size_t right) NOEXCEPT
+            {
+                return sip_words(messages[left].size()) <
+                    sip_words(messages[right].size());
+            });
+    }
+
+    size_t next{};
+    sip_vector<xint512_t>(hashes, key, messages, order, next);
+    sip_vector<xint256_t>(hashes, key, messages, order, next);
+    sip_vector<xint128_t>(hashes, key, messages, order, next);
+
+    // Serial form is compiled for the library instruction set.
+    for (; next < count; ++next)
+        hashes[order[next]] = siphash(key, messages[order[next]]);
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
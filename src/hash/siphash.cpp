@@ -22,10 +22,13 @@
 #include <bitcoin/system/hash/siphash.hpp>
 
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/sha/dispatch.hpp>
+#include "sip_lanes.hpp"
 
 // This would be circular a /hash include (must stay in cpp).
 #include <bitcoin/system/stream/stream.hpp>
@@ -33,13 +36,6 @@
 namespace libbitcoin {
 namespace system {
 
-constexpr uint64_t siphash_magic_0 = 0x736f6d6570736575;
-constexpr uint64_t siphash_magic_1 = 0x646f72616e646f6d;
-constexpr uint64_t siphash_magic_2 = 0x6c7967656e657261;
-constexpr uint64_t siphash_magic_3 = 0x7465646279746573;
-constexpr uint64_t finalization = 0x00000000000000ff;
-constexpr uint64_t max_encoded_byte_count = (1 << byte_bits);
-
 // local
 constexpr void sip_round(uint64_t& v0, uint64_t& v1, uint64_t& v2,
     uint64_t& v3) NOEXCEPT
@@ -110,5 +106,19 @@ uint64_t siphash(const half_hash& hash, const data_slice& message) NOEXCEPT
     return siphash(to_siphash_key(hash), message);
 }
 
+std::vector<uint64_t> siphash_batch(const siphash_key& key,
+    const std::vector<data_slice>& messages) NOEXCEPT
+{
+    std::vector<uint64_t> hashes{};
+
+    // Runtime selected lanes (avx512, avx2, native or portable).
+    if constexpr (have_dispatch)
+        sha::dispatch().sip_batch(hashes, key, messages);
+    else
+        sip_batch(hashes, key, messages);
+
+    return hashes;
+}
+
 } // namespace system
 } // namespace libbitcoin
@@ -145,6 +145,118 @@ BOOST_AUTO_TEST_CASE(default_arena__is_equal__different__false)
     BOOST_REQUIRE(!instance.is_equal(other));
 }
 
+// linear_arena
+
+BOOST_AUTO_TEST_CASE(linear_arena__start__baseline__non_null_minimum_size)
+{
+    linear_arena instance{ 64 };
+    const auto memory = instance.start(42);
+    BOOST_REQUIRE(!is_null(memory));
+    BOOST_REQUIRE_EQUAL(instance.detach(), 64u);
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__start__baseline_above_minimum__baseline_size)
+{
+    linear_arena instance{ 64 };
+    const auto memory = instance.start(128);
+    BOOST_REQUIRE_EQUAL(instance.detach(), 128u);
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__allocate__within_buffer__contiguous_aligned)
+{
+    linear_arena instance{ 64 };
+    const auto memory = instance.start(zero);
+    const auto first = system::pointer_cast<uint8_t>(instance.allocate(3, 1));
+    const auto second = system::pointer_cast<uint8_t>(instance.allocate(8, 8));
+    BOOST_REQUIRE_EQUAL(std::next(first, 8), second);
+    BOOST_REQUIRE_EQUAL(instance.detach(), 64u);
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__allocate__exceeds_buffer__extends)
+{
+    linear_arena instance{ 64 };
+    const auto memory = instance.start(zero);
+    BOOST_REQUIRE(!is_null(instance.allocate(48)));
+    BOOST_REQUIRE(!is_null(instance.allocate(48)));
+    BOOST_REQUIRE(!is_null(instance.allocate(256)));
+    BOOST_REQUIRE_GT(instance.detach(), 128u);
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__allocate__not_started__implicit_start)
+{
+    linear_arena instance{ 64 };
+    BOOST_REQUIRE(!is_null(instance.allocate(42)));
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__deallocate__any__does_not_throw)
+{
+    linear_arena instance{ 64 };
+    const auto ptr = instance.allocate(42);
+    BOOST_REQUIRE_NO_THROW(instance.deallocate(ptr, 42));
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__release__nullptr__does_not_throw)
+{
+    linear_arena instance{};
+    BOOST_REQUIRE_NO_THROW(instance.release(nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__is_equal__same__true)
+{
+    linear_arena instance{};
+    BOOST_REQUIRE(instance.is_equal(instance));
+}
+
+BOOST_AUTO_TEST_CASE(linear_arena__is_equal__different__false)
+{
+    linear_arena other{};
+    linear_arena instance{};
+    BOOST_REQUIRE(!instance.is_equal(other));
+}
+
+// inline_arena
+
+BOOST_AUTO_TEST_CASE(inline_arena__allocate__within_buffer__contiguous)
+{
+    inline_arena<64> instance{};
+    const auto first = static_cast<uint8_t*>(instance.allocate(16, 8));
+    const auto second = static_cast<uint8_t*>(instance.allocate(16, 8));
+    BOOST_REQUIRE(!is_null(first));
+    BOOST_REQUIRE_EQUAL(std::distance(first, second), 16);
+    BOOST_REQUIRE_EQUAL(instance.detach(), 32u);
+    instance.deallocate(first, 16, 8);
+    instance.deallocate(second, 16, 8);
+}
+
+BOOST_AUTO_TEST_CASE(inline_arena__allocate__exceeds_buffer__default_allocation)
+{
+    inline_arena<64> instance{};
+    const auto ptr = instance.allocate(128, 8);
+    BOOST_REQUIRE(!is_null(ptr));
+    BOOST_REQUIRE_EQUAL(instance.detach(), 0u);
+
+    // Deallocation of an overflow returns memory to the default arena.
+    instance.deallocate(ptr, 128, 8);
+}
+
+BOOST_AUTO_TEST_CASE(inline_arena__start__any__nullptr)
+{
+    inline_arena<64> instance{};
+    BOOST_REQUIRE(is_null(instance.start(42)));
+}
+
+BOOST_AUTO_TEST_CASE(inline_arena__is_equal__different__false)
+{
+    inline_arena<64> other{};
+    inline_arena<64> instance{};
+    BOOST_REQUIRE(instance.is_equal(instance));
+    BOOST_REQUIRE(!instance.is_equal(other));
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
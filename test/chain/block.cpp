@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "spender.hpp"
 
 BOOST_AUTO_TEST_SUITE(block_tests)
 
@@ -290,6 +291,46 @@ BOOST_AUTO_TEST_CASE(block__constructor__reader__success)
     BOOST_REQUIRE(!block.is_invalid_merkle_root());
 }
 
+// from_arena
+
+BOOST_AUTO_TEST_CASE(block__from_arena__linear_arena__expected_allocation)
+{
+    const auto block1 = get_block();
+    const auto data = block1.to_data(true);
+    linear_arena arena{ 1024 };
+    const auto block = block::from_arena(arena, data, true);
+    BOOST_REQUIRE(block->is_valid());
+    BOOST_REQUIRE(*block == block1);
+    BOOST_REQUIRE_GE(block->get_allocation(), 1024u);
+    BOOST_REQUIRE_EQUAL(block->to_data(true), data);
+}
+
+BOOST_AUTO_TEST_CASE(block__from_arena__reused_linear_arena__independent_blocks)
+{
+    const auto block1 = get_block();
+    const auto data = block1.to_data(true);
+    linear_arena arena{ 64 };
+    auto first = block::from_arena(arena, data, true);
+    const auto second = block::from_arena(arena, data, true);
+    first.reset();
+    BOOST_REQUIRE(second->is_valid());
+    BOOST_REQUIRE(*second == block1);
+}
+
+BOOST_AUTO_TEST_CASE(block__from_arena__non_detachable_arena__deallocates_all)
+{
+    const auto block1 = get_block();
+    const auto data = block1.to_data(true);
+    test::reporting_arena<false> arena{};
+    auto block = block::from_arena(arena, data, true);
+    BOOST_REQUIRE(block->is_valid());
+    BOOST_REQUIRE(*block == block1);
+    BOOST_REQUIRE_EQUAL(block->get_allocation(), zero);
+    block.reset();
+    BOOST_REQUIRE_EQUAL(arena.inc_count, arena.dec_count);
+    BOOST_REQUIRE_EQUAL(arena.inc_bytes, arena.dec_bytes);
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -374,6 +415,30 @@ BOOST_AUTO_TEST_CASE(block__to_data__writer__expected)
     BOOST_REQUIRE(copy == expected_block::get());
 }
 
+BOOST_AUTO_TEST_CASE(block__to_data__gather__expected)
+{
+    const auto& instance = expected_block::get();
+    gather sink{};
+    instance.to_data(sink);
+    BOOST_REQUIRE_EQUAL(sink.size(true), instance.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(sink.to_data(true), instance.to_data(true));
+    BOOST_REQUIRE_EQUAL(sink.to_data(false), instance.to_data(false));
+}
+
+BOOST_AUTO_TEST_CASE(block__to_data__gather_genesis__references_header_hashes)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    gather sink{};
+    genesis.to_data(sink);
+    BOOST_REQUIRE_EQUAL(sink.to_data(false), genesis.to_data(false));
+
+    // Hashes are referenced in place (slices point into the header object).
+    const auto slices = sink.to_slices(false);
+    BOOST_REQUIRE_GT(slices.size(), 2u);
+    BOOST_REQUIRE_EQUAL(slices.at(1).data(), genesis.header().previous_block_hash().data());
+    BOOST_REQUIRE_EQUAL(slices.at(2).data(), genesis.header().merkle_root().data());
+}
+
 // properties
 // ----------------------------------------------------------------------------
 
@@ -381,6 +446,47 @@ BOOST_AUTO_TEST_CASE(block__to_data__writer__expected)
 // fees
 // claim
 
+BOOST_AUTO_TEST_CASE(block__get_metrics__genesis__expected)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto& metrics = genesis.get_metrics();
+    BOOST_REQUIRE_EQUAL(metrics.nominal, 285u);
+    BOOST_REQUIRE_EQUAL(metrics.witnessed, 285u);
+    BOOST_REQUIRE_EQUAL(metrics.weight, 4u * 285u);
+    BOOST_REQUIRE(is_zero(metrics.outputs));
+    BOOST_REQUIRE(is_zero(metrics.spends));
+    BOOST_REQUIRE(is_zero(metrics.segregated));
+    BOOST_REQUIRE_EQUAL(genesis.weight(), metrics.weight);
+    BOOST_REQUIRE_EQUAL(genesis.serialized_size(false), metrics.nominal);
+    BOOST_REQUIRE_EQUAL(genesis.serialized_size(true), metrics.witnessed);
+}
+
+BOOST_AUTO_TEST_CASE(block__get_metrics__expected_block__excludes_coinbase)
+{
+    const auto& instance = expected_block::get();
+    const auto& metrics = instance.get_metrics();
+    BOOST_REQUIRE_EQUAL(metrics.outputs, 2u);
+    BOOST_REQUIRE_EQUAL(metrics.spends, 2u);
+    BOOST_REQUIRE_EQUAL(metrics.nominal, instance.to_data(false).size());
+    BOOST_REQUIRE_EQUAL(metrics.witnessed, instance.to_data(true).size());
+    BOOST_REQUIRE_EQUAL(instance.outputs(), metrics.outputs);
+    BOOST_REQUIRE_EQUAL(instance.spends(), metrics.spends);
+}
+
+BOOST_AUTO_TEST_CASE(block__signature_operations__genesis__expected)
+{
+    // Coinbase output is pay-to-public-key (one checksig).
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    BOOST_REQUIRE_EQUAL(genesis.signature_operations(false, false), 1u);
+    BOOST_REQUIRE_EQUAL(genesis.signature_operations(true, false), 1u);
+    BOOST_REQUIRE_EQUAL(genesis.signature_operations(true, true), 4u);
+
+    // Cached legacy count is reused.
+    genesis.set_signature_operations();
+    BOOST_REQUIRE_EQUAL(genesis.signature_operations(false, false), 1u);
+    BOOST_REQUIRE_EQUAL(genesis.signature_operations(true, true), 4u);
+}
+
 BOOST_AUTO_TEST_CASE(block__spends__genesis__zero)
 {
     const auto genesis = settings(selection::mainnet).genesis_block;
@@ -398,6 +504,110 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
     BOOST_REQUIRE_EQUAL(instance.hash(), instance.header().hash());
 }
 
+// set_transaction_hashes
+
+BOOST_AUTO_TEST_CASE(block__set_transaction_hashes__nominal__expected_cached)
+{
+    const accessor instance{ expected_block::data(), true };
+    const auto& txs = expected_transactions::get();
+    instance.set_transaction_hashes(false);
+
+    const auto& cached = *instance.transactions_ptr();
+    BOOST_REQUIRE_EQUAL(cached.size(), txs.size());
+    BOOST_REQUIRE_EQUAL(cached[0]->get_hash(false), txs[0].hash(false));
+    BOOST_REQUIRE_EQUAL(cached[1]->get_hash(false), txs[1].hash(false));
+    BOOST_REQUIRE_EQUAL(cached[2]->get_hash(false), txs[2].hash(false));
+    BOOST_REQUIRE(!instance.is_invalid_merkle_root());
+}
+
+// Segregated coinbase, followed by segregated (non-coinbase) txs, replicated
+// to span multiple concurrent sets.
+static block segregated_block(size_t count)
+{
+    const transaction coinbase
+    {
+        1u,
+        inputs
+        {
+            {
+                point{ null_hash, point::null_index },
+                script{ { { opcode::nop1 }, { opcode::nop2 } } },
+                witness{ data_stack{ data_chunk(32u, 0x00) } },
+                0u
+            }
+        },
+        outputs{ { 0u, script{} } },
+        0u
+    };
+
+    transactions txs{ coinbase };
+    txs.resize(count, signed_spender({ key_path_spend() }));
+    return { header{}, std::move(txs) };
+}
+
+BOOST_AUTO_TEST_CASE(block__set_transaction_hashes__witness_sets__expected_cached)
+{
+    const auto instance = segregated_block(130);
+    const auto& coinbase = *instance.transactions_ptr()->front();
+    const auto& tx = *instance.transactions_ptr()->back();
+    BOOST_REQUIRE(coinbase.is_segregated());
+    BOOST_REQUIRE(tx.is_segregated());
+    instance.set_transaction_hashes(true);
+
+    const auto nominal = bitcoin_hash(tx.to_data(false));
+    const auto witness = bitcoin_hash(tx.to_data(true));
+    const auto& cached = *instance.transactions_ptr();
+    BOOST_REQUIRE_EQUAL(cached.size(), 130u);
+    BOOST_REQUIRE_EQUAL(cached.front()->get_hash(false),
+        bitcoin_hash(coinbase.to_data(false)));
+    BOOST_REQUIRE_EQUAL(cached[64]->get_hash(false), nominal);
+    BOOST_REQUIRE_EQUAL(cached.back()->get_hash(false), nominal);
+    BOOST_REQUIRE_EQUAL(cached[64]->get_hash(true), witness);
+    BOOST_REQUIRE_EQUAL(cached.back()->get_hash(true), witness);
+
+    // Witness hash of coinbase is not cached.
+    BOOST_REQUIRE(!cached.front()->has_hash(true));
+
+    // Cached hashes are the same as computed hashes.
+    const auto uncached = segregated_block(130);
+    BOOST_REQUIRE_EQUAL(instance.transaction_hashes(false),
+        uncached.transaction_hashes(false));
+    BOOST_REQUIRE_EQUAL(instance.transaction_hashes(true),
+        uncached.transaction_hashes(true));
+}
+
+// transaction_hashes
+
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__segregated_coinbase__null_witness_hash_not_cached)
+{
+    const auto instance = segregated_block(130);
+    const auto& coinbase = *instance.transactions_ptr()->front();
+    const auto& tx = *instance.transactions_ptr()->back();
+
+    // Witness hash of segregated coinbase is null_hash [bip141].
+    auto witnessed = hashes(130, bitcoin_hash(tx.to_data(true)));
+    witnessed.front() = null_hash;
+    auto nominal = hashes(130, bitcoin_hash(tx.to_data(false)));
+    nominal.front() = bitcoin_hash(coinbase.to_data(false));
+    BOOST_REQUIRE_EQUAL(instance.transaction_hashes(true), witnessed);
+    BOOST_REQUIRE_EQUAL(instance.transaction_hashes(false), nominal);
+    BOOST_REQUIRE(!tx.has_hash(false));
+    BOOST_REQUIRE(!tx.has_hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__non_segregated_coinbase__nominal_witness_hash)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto& coinbase = *genesis.transactions_ptr()->front();
+    BOOST_REQUIRE(!coinbase.is_segregated());
+    BOOST_REQUIRE_EQUAL(genesis.transaction_hashes(true),
+        hashes{ coinbase.hash(false) });
+
+    genesis.set_transaction_hashes(true);
+    BOOST_REQUIRE_EQUAL(genesis.transaction_hashes(true),
+        hashes{ coinbase.hash(false) });
+}
+
 // is_malleable
 // is_segregated
 // serialized_size
@@ -410,6 +620,152 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
 // accept
 // connect
 
+// Each call creates distinct inputs (prevouts are not shared across inputs).
+static transaction spender(opcode code) NOEXCEPT
+{
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ hash1, 0 }, script{}, 0 } },
+        outputs{ { 0, script{} } },
+        0
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared(output
+    {
+        0u, script{ operations{ { code } } }
+    });
+
+    return tx;
+}
+
+static block connect_block(const std_vector<opcode>& codes) NOEXCEPT
+{
+    transactions txs{ *get_block().transactions_ptr()->front() };
+    for (const auto code: codes)
+        txs.push_back(spender(code));
+
+    return { header{}, std::move(txs) };
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__concurrent_valid__success)
+{
+    const auto instance = connect_block(std_vector<opcode>(
+        100, opcode::push_positive_1));
+
+    BOOST_REQUIRE(!instance.connect({}, false));
+    BOOST_REQUIRE(!instance.connect({}, true));
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__concurrent_failures__first_failure)
+{
+    std_vector<opcode> codes(100, opcode::push_positive_1);
+    codes[42] = opcode::push_size_0;
+    codes[84] = opcode::op_return;
+    const auto instance = connect_block(codes);
+    const auto& txs = *instance.transactions_ptr();
+
+    // Failures differ, and the first failure (in block order) is returned.
+    const auto expected = txs[add1(42)]->connect({});
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE_NE(txs[add1(84)]->connect({}), expected);
+    BOOST_REQUIRE_EQUAL(instance.connect({}, false), expected);
+    BOOST_REQUIRE_EQUAL(instance.connect({}, true), expected);
+}
+
+// Serial connect defers to a signature batch, concurrent connects in place.
+static block signed_block(const std_vector<spends>& txs)
+{
+    transactions block_txs{ *get_block().transactions_ptr()->front() };
+    for (const auto& items: txs)
+        block_txs.push_back(signed_spender(items));
+
+    return { header{}, std::move(block_txs) };
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__batched_valid__success)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto instance = signed_block(
+    {
+        { key_path_spend(), script_path_spend(), key_hash_spend() },
+        { script_path_spend(), key_path_spend() }
+    });
+
+    BOOST_REQUIRE_EQUAL(instance.connect(ctx, false), error::block_success);
+    BOOST_REQUIRE_EQUAL(instance.connect(ctx, true), error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__batched_bad_signature__in_place_result)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    for (const auto& bad: { key_path_spend(true), script_path_spend(true) })
+    {
+        const auto instance = signed_block(
+        {
+            { key_path_spend(), key_hash_spend() },
+            { script_path_spend(), bad }
+        });
+
+        const auto expected = instance.transactions_ptr()->back()->connect(ctx);
+        BOOST_REQUIRE(expected);
+        BOOST_REQUIRE_EQUAL(instance.connect(ctx, false), expected);
+        BOOST_REQUIRE_EQUAL(instance.connect(ctx, true), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__batched_bad_commitment__in_place_result)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto instance = signed_block(
+    {
+        { key_path_spend(), key_hash_spend() },
+        { script_path_spend(false, true) }
+    });
+
+    const auto expected = instance.transactions_ptr()->back()->connect(ctx);
+    BOOST_REQUIRE_EQUAL(expected, error::invalid_commitment);
+    BOOST_REQUIRE_EQUAL(instance.connect(ctx, false), expected);
+    BOOST_REQUIRE_EQUAL(instance.connect(ctx, true), expected);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__batched_mixed_failures__first_failure)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    for (const auto& deferred: { key_path_spend(true), script_path_spend(true),
+        script_path_spend(false, true) })
+    {
+        // Deferred failure precedes the in place (ecdsa) failure.
+        const auto deferred_first = signed_block(
+        {
+            { key_path_spend(), deferred },
+            { key_hash_spend(true) }
+        });
+
+        const auto& first = deferred_first.transactions_ptr()->at(1);
+        const auto expected = first->connect(ctx);
+        BOOST_REQUIRE(expected);
+        BOOST_REQUIRE_EQUAL(deferred_first.connect(ctx, false), expected);
+        BOOST_REQUIRE_EQUAL(deferred_first.connect(ctx, true), expected);
+
+        // In place (ecdsa) failure precedes the deferred failure.
+        const auto in_place_first = signed_block(
+        {
+            { key_hash_spend(true) },
+            { key_path_spend(), deferred }
+        });
+
+        BOOST_REQUIRE_EQUAL(in_place_first.connect(ctx, false),
+            error::stack_false);
+        BOOST_REQUIRE_EQUAL(in_place_first.connect(ctx, true),
+            error::stack_false);
+    }
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
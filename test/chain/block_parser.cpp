@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_parser_tests)
+
+using namespace system::chain;
+
+static const transaction segregated_tx
+{
+    2u,
+    inputs
+    {
+        { point{ one_hash, 0 }, script{}, witness{ "[0102] [0304]" }, 42u },
+        { point{ one_hash, 1 }, script{ "[0506] drop" }, witness{}, 24u }
+    },
+    outputs
+    {
+        { 1000u, script{ "[0708] drop" } }
+    },
+    7u
+};
+
+static block mixed_block() NOEXCEPT
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    return
+    {
+        genesis.header(),
+        transactions
+        {
+            *genesis.transactions_ptr()->front(),
+            segregated_tx
+        }
+    };
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__construct__default__empty)
+{
+    const block_parser instance{};
+    BOOST_REQUIRE(!instance.is_complete());
+    BOOST_REQUIRE(!instance.is_failed());
+    BOOST_REQUIRE(!instance.header_ptr());
+    BOOST_REQUIRE(!instance.to_block().is_valid());
+    BOOST_REQUIRE_EQUAL(instance.position(), zero);
+    BOOST_REQUIRE_EQUAL(instance.declared(), zero);
+    BOOST_REQUIRE_EQUAL(instance.parsed(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__genesis_one_chunk__complete)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+
+    block_parser instance{};
+    const auto txs = instance.push(data);
+    BOOST_REQUIRE_EQUAL(txs.size(), one);
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE(!instance.is_failed());
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size());
+    BOOST_REQUIRE_EQUAL(instance.declared(), one);
+    BOOST_REQUIRE_EQUAL(instance.parsed(), one);
+    BOOST_REQUIRE(*instance.header_ptr() == genesis.header());
+    BOOST_REQUIRE(instance.to_block() == genesis);
+    BOOST_REQUIRE_EQUAL(txs.front()->hash(false), genesis.transactions_ptr()->front()->hash(false));
+    BOOST_REQUIRE_EQUAL(instance.to_block().hash(), genesis.hash());
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__mixed_bytewise__expected_hashes)
+{
+    const auto expected = mixed_block();
+    const auto data = expected.to_data(true);
+
+    block_parser instance{};
+    transaction_cptrs txs{};
+    for (const auto byte: data)
+    {
+        BOOST_REQUIRE(!instance.is_complete());
+        const auto out = instance.push({ byte });
+        txs.insert(txs.end(), out.begin(), out.end());
+    }
+
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size());
+    BOOST_REQUIRE_EQUAL(txs.size(), two);
+    BOOST_REQUIRE(instance.to_block() == expected);
+
+    // Cached hashes match those computed from uncached copies.
+    const transaction coinbase{ txs.front()->to_data(true), true };
+    const transaction segregated{ txs.back()->to_data(true), true };
+    BOOST_REQUIRE(segregated.is_segregated());
+    BOOST_REQUIRE_EQUAL(txs.front()->hash(false), coinbase.hash(false));
+    BOOST_REQUIRE_EQUAL(txs.front()->hash(true), coinbase.hash(true));
+    BOOST_REQUIRE_EQUAL(txs.back()->hash(false), segregated.hash(false));
+    BOOST_REQUIRE_EQUAL(txs.back()->hash(true), segregated.hash(true));
+    BOOST_REQUIRE_NE(txs.back()->hash(true), txs.back()->hash(false));
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__split_chunks__emits_completed_transactions)
+{
+    const auto expected = mixed_block();
+    const auto data = expected.to_data(true);
+    const auto coinbase = expected.transactions_ptr()->front()->serialized_size(true);
+    const auto split = header::serialized_size() + one + coinbase + one;
+
+    block_parser instance{};
+    const auto first = instance.push({ data.begin(), std::next(data.begin(), split) });
+    BOOST_REQUIRE_EQUAL(first.size(), one);
+    BOOST_REQUIRE_EQUAL(instance.position(), sub1(split));
+    BOOST_REQUIRE_EQUAL(instance.declared(), two);
+    BOOST_REQUIRE_EQUAL(instance.parsed(), one);
+    BOOST_REQUIRE(!instance.is_complete());
+    BOOST_REQUIRE(!instance.to_block().is_valid());
+
+    const auto second = instance.push({ std::next(data.begin(), split), data.end() });
+    BOOST_REQUIRE_EQUAL(second.size(), one);
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE(instance.to_block() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__resumed_chunks__expected_block)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const block expected
+    {
+        genesis.header(),
+        transactions
+        {
+            *genesis.transactions_ptr()->front(),
+            segregated_tx,
+            segregated_tx,
+            segregated_tx
+        }
+    };
+
+    // Chunks that split elements resume scanning where the last one stopped.
+    const auto data = expected.to_data(true);
+    block_parser instance{};
+    size_t count{};
+    for (size_t start = 0; start < data.size(); start += 7u)
+    {
+        const auto end = std::min(data.size(), start + 7u);
+        count += instance.push({ std::next(data.begin(), start),
+            std::next(data.begin(), end) }).size();
+    }
+
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE_EQUAL(count, 4u);
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size());
+    BOOST_REQUIRE(instance.to_block() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__oversized_count__fails_at_count)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    auto data = genesis.header().to_data();
+    data.push_back(varint_four_bytes);
+    data.insert(data.end(), { 0xff, 0xff, 0xff, 0xff });
+
+    block_parser instance{};
+    BOOST_REQUIRE(instance.push(data).empty());
+    BOOST_REQUIRE(instance.is_failed());
+    BOOST_REQUIRE(!instance.is_complete());
+    BOOST_REQUIRE_EQUAL(instance.position(), header::serialized_size());
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__maximum_count_short__not_failed)
+{
+    // Maximal declared count without transactions (nothing reserved for it).
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    auto data = genesis.header().to_data();
+    data.push_back(varint_four_bytes);
+    data.insert(data.end(), { 0x40, 0x42, 0x0f, 0x00 });
+
+    block_parser instance{};
+    BOOST_REQUIRE(instance.push(data).empty());
+    BOOST_REQUIRE(!instance.is_failed());
+    BOOST_REQUIRE(!instance.is_complete());
+    BOOST_REQUIRE_EQUAL(instance.declared(), max_block_size);
+    BOOST_REQUIRE_EQUAL(instance.parsed(), zero);
+
+    // Transactions are accepted as pushed.
+    const auto coinbase = genesis.transactions_ptr()->front()->to_data(true);
+    const auto txs = instance.push(coinbase);
+    BOOST_REQUIRE_EQUAL(txs.size(), one);
+    BOOST_REQUIRE(!instance.is_failed());
+    BOOST_REQUIRE_EQUAL(instance.parsed(), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__oversized_script__fails_at_transaction)
+{
+    const auto expected = mixed_block();
+    auto data = expected.to_data(true);
+    const auto coinbase = expected.transactions_ptr()->front()->serialized_size(true);
+    const auto start = header::serialized_size() + one + coinbase;
+
+    // Corrupt the script size of the first input of the second transaction.
+    // version, marker, flag, input count, point.
+    const auto script = start + 4u + 1u + 1u + 1u + point::serialized_size();
+    data.at(script) = varint_eight_bytes;
+
+    block_parser instance{};
+    const auto txs = instance.push(data);
+    BOOST_REQUIRE_EQUAL(txs.size(), one);
+    BOOST_REQUIRE(instance.is_failed());
+    BOOST_REQUIRE_EQUAL(instance.position(), start);
+
+    // Subsequent pushes are ignored.
+    BOOST_REQUIRE(instance.push(data).empty());
+    BOOST_REQUIRE_EQUAL(instance.position(), start);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__trailing_bytes__fails_at_end)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    auto data = genesis.to_data(true);
+    const auto size = data.size();
+    data.push_back(0x42);
+
+    block_parser instance{};
+    BOOST_REQUIRE_EQUAL(instance.push(data).size(), one);
+    BOOST_REQUIRE(instance.is_failed());
+    BOOST_REQUIRE(!instance.is_complete());
+    BOOST_REQUIRE_EQUAL(instance.position(), size);
+}
+
+BOOST_AUTO_TEST_CASE(block_parser__push__after_complete__fails)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+
+    block_parser instance{};
+    BOOST_REQUIRE_EQUAL(instance.push(data).size(), one);
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE(instance.push(data_slice{}).empty());
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE(instance.push({ 0x00 }).empty());
+    BOOST_REQUIRE(instance.is_failed());
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
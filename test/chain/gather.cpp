@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(gather_tests)
+
+using namespace system::chain;
+
+BOOST_AUTO_TEST_CASE(gather__to_data__default__empty)
+{
+    const gather instance{};
+    BOOST_REQUIRE(instance.to_slices(true).empty());
+    BOOST_REQUIRE(is_zero(instance.size(true)));
+    BOOST_REQUIRE(instance.to_data(true).empty());
+}
+
+BOOST_AUTO_TEST_CASE(gather__write__consecutive__coalesced)
+{
+    gather instance{};
+    instance.write_byte(0x01);
+    instance.write_4_bytes_little_endian(0x05040302);
+    instance.write_8_bytes_little_endian(0x0d0c0b0a09080706);
+    instance.write_bytes(base16_chunk("0e0f"));
+
+    const auto slices = instance.to_slices(false);
+    BOOST_REQUIRE_EQUAL(slices.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.size(false), 15u);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), base16_chunk("0102030405060708090a0b0c0d0e0f"));
+}
+
+BOOST_AUTO_TEST_CASE(gather__write_variable__all_widths__expected)
+{
+    gather instance{};
+    instance.write_variable(0xfc);
+    instance.write_variable(0xfd);
+    instance.write_variable(0x00010000);
+    instance.write_variable(0x0000000100000000);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), base16_chunk(
+        "fc" "fdfd00" "fe00000100" "ff0000000001000000"));
+}
+
+BOOST_AUTO_TEST_CASE(gather__reference__large__not_copied)
+{
+    const data_chunk large(42, 0x42);
+    gather instance{};
+    instance.write_byte(0x2a);
+    instance.reference(large);
+    instance.write_byte(0x2a);
+
+    const auto slices = instance.to_slices(false);
+    BOOST_REQUIRE_EQUAL(slices.size(), 3u);
+    BOOST_REQUIRE_EQUAL(slices.at(1).data(), large.data());
+    BOOST_REQUIRE_EQUAL(slices.at(1).size(), large.size());
+    BOOST_REQUIRE_EQUAL(instance.size(false), 44u);
+}
+
+BOOST_AUTO_TEST_CASE(gather__reference__small__copied)
+{
+    const data_chunk small{ 0x01, 0x02 };
+    gather instance{};
+    instance.write_byte(0x00);
+    instance.reference(small);
+
+    const auto slices = instance.to_slices(false);
+    BOOST_REQUIRE_EQUAL(slices.size(), 1u);
+    BOOST_REQUIRE_NE(slices.front().data(), small.data());
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), base16_chunk("000102"));
+}
+
+BOOST_AUTO_TEST_CASE(gather__to_slices__witness_segments__selected)
+{
+    const data_chunk large(32, 0xff);
+    gather instance{};
+    instance.write_byte(0x01);
+    instance.set_witness(true);
+    instance.write_byte(0x02);
+    instance.reference(large);
+    instance.set_witness(false);
+    instance.write_byte(0x03);
+
+    BOOST_REQUIRE_EQUAL(instance.to_slices(false).size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.to_slices(true).size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.size(false), 2u);
+    BOOST_REQUIRE_EQUAL(instance.size(true), 35u);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), base16_chunk("0103"));
+    BOOST_REQUIRE_EQUAL(instance.to_data(true),
+        splice(splice(base16_chunk("0102"), large), base16_chunk("03")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
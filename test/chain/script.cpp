@@ -295,6 +295,92 @@ BOOST_AUTO_TEST_CASE(script__from_data__to_data_weird__roundtrips)
     BOOST_REQUIRE_EQUAL(roundtrip, weird_raw_script);
 }
 
+// lazy parse
+
+BOOST_AUTO_TEST_CASE(script__from_data__lazy_ops__expected)
+{
+    const auto data = base16_chunk("76a91406ccef231c2db72526df9338894ccf9355e8f12188ac");
+    const script instance(data, false);
+    const script expected(script::to_pay_key_hash_pattern(base16_array("06ccef231c2db72526df9338894ccf9355e8f121")));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), data.size());
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE_EQUAL(instance.ops().size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), data);
+}
+
+BOOST_AUTO_TEST_CASE(script__from_data__copy_unparsed__equal)
+{
+    const auto data = base16_chunk("0014" "06ccef231c2db72526df9338894ccf9355e8f121");
+    const script instance(data, false);
+    const script copy(instance);
+    BOOST_REQUIRE(copy == instance);
+    BOOST_REQUIRE_EQUAL(copy.ops().size(), 2u);
+    BOOST_REQUIRE(copy == instance);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), data);
+}
+
+BOOST_AUTO_TEST_CASE(script__from_data__underflow__prefail_underflow)
+{
+    const auto data = base16_chunk("ac4c");
+    const script instance(data, false);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_prefail());
+    BOOST_REQUIRE(instance.is_underflow());
+    BOOST_REQUIRE_EQUAL(instance.ops().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), data);
+}
+
+BOOST_AUTO_TEST_CASE(script__from_data__prefix_truncated__invalid)
+{
+    const auto data = base16_chunk("1976a914");
+    const script instance(data, true);
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.ops().empty());
+}
+
+BOOST_AUTO_TEST_CASE(script__output_pattern__serialized_pay_key_hash_push_data__expected)
+{
+    const auto nominal = base16_chunk("76a914" "06ccef231c2db72526df9338894ccf9355e8f121" "88ac");
+    const auto one = base16_chunk("76a94c14" "06ccef231c2db72526df9338894ccf9355e8f121" "88ac");
+    const auto two = base16_chunk("76a94d1400" "06ccef231c2db72526df9338894ccf9355e8f121" "88ac");
+    const auto four = base16_chunk("76a94e14000000" "06ccef231c2db72526df9338894ccf9355e8f121" "88ac");
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(nominal));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(one));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(two));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(four));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(script(one, false).ops()));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(script(four, false).ops()));
+    BOOST_REQUIRE(script(two, false).output_pattern() == script_pattern::pay_key_hash);
+}
+
+BOOST_AUTO_TEST_CASE(script__output_pattern__serialized_patterns__expected)
+{
+    const auto p2sh = base16_chunk("a914" "06ccef231c2db72526df9338894ccf9355e8f121" "87");
+    const auto p2wpkh = base16_chunk("0014" "06ccef231c2db72526df9338894ccf9355e8f121");
+    const auto p2wsh = base16_chunk("0020" "06ccef231c2db72526df9338894ccf9355e8f12106ccef231c2db72526df9338");
+    BOOST_REQUIRE(script::is_pay_script_hash_pattern(p2sh));
+    BOOST_REQUIRE(script::is_pay_witness_key_hash_pattern(p2wpkh));
+    BOOST_REQUIRE(script::is_pay_witness_script_hash_pattern(p2wsh));
+    BOOST_REQUIRE(script::is_witness_program_pattern(p2wpkh));
+    BOOST_REQUIRE(script::is_witness_program_pattern(p2wsh));
+    BOOST_REQUIRE(!script::is_witness_program_pattern(p2sh));
+    BOOST_REQUIRE(script(p2sh, false).output_pattern() == script_pattern::pay_script_hash);
+    BOOST_REQUIRE(script(p2wpkh, false).output_pattern() == script_pattern::pay_witness_key_hash);
+    BOOST_REQUIRE(script(p2wsh, false).output_pattern() == script_pattern::pay_witness_script_hash);
+    BOOST_REQUIRE(script(p2wsh, false).version() == script_version::segwit);
+    BOOST_REQUIRE(script(p2sh, false).is_pay_to_script_hash(flags::bip16_rule));
+    BOOST_REQUIRE(script(p2wsh, false).is_pay_to_witness(flags::bip141_rule));
+}
+
+BOOST_AUTO_TEST_CASE(script__is_witness_program_pattern__serialized_non_minimal__false)
+{
+    // A one byte program is not a witness program (below minimum).
+    const auto data = base16_chunk("5101ff");
+    BOOST_REQUIRE(!script::is_witness_program_pattern(data));
+    BOOST_REQUIRE(!script::is_witness_program_pattern(script(data, false).ops()));
+}
+
 BOOST_AUTO_TEST_CASE(script__factory_chunk_test)
 {
     const auto raw = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
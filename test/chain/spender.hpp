@@ -0,0 +1,265 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_TEST_SPENDER_HPP
+#define LIBBITCOIN_SYSTEM_TEST_SPENDER_HPP
+
+#include "../test.hpp"
+
+// Signed p2tr (key and script path) and p2wpkh spends, for comparison of
+// deferred (signature batch) and in place signature verification.
+
+constexpr auto spend_flags =
+    chain::flags::bip16_rule |
+    chain::flags::bip141_rule |
+    chain::flags::bip143_rule |
+    chain::flags::bip341_rule |
+    chain::flags::bip342_rule;
+
+struct spend
+{
+    enum class type
+    {
+        key_path,
+        script_path,
+        key_hash
+    };
+
+    type kind{ type::key_path };
+
+    // Script path leaf, executed with signature (if sign) and stack elements.
+    chain::script leaf{};
+    data_stack stack{};
+    bool sign{ true };
+
+    // Invalidate the signature, or the script path taproot commitment.
+    bool bad_signature{};
+    bool bad_commitment{};
+};
+
+typedef std_vector<spend> spends;
+
+inline ec_secret spend_secret()
+{
+    ec_secret secret{};
+    secret.back() = 42;
+    return secret;
+}
+
+inline ec_compressed spend_key()
+{
+    ec_compressed key{};
+    BOOST_REQUIRE(secret_to_public(key, spend_secret()));
+    return key;
+}
+
+// The x-only spend key.
+inline ec_xonly spend_point()
+{
+    return slice<one, ec_compressed_size>(spend_key());
+}
+
+// Version 1 witness program. script::to_pay_witness_taproot_pattern emits
+// push_size_1 in place of the version (op_1), so is not a witness program.
+inline chain::script taproot_script(const ec_xonly& out_key)
+{
+    using namespace chain;
+    return script
+    {
+        {
+            { opcode::push_positive_1 },
+            { to_chunk(out_key), false }
+        }
+    };
+}
+
+// Leaf script: [dup key checksig verify] * repeats, key checksig [not].
+inline chain::script checksig_leaf(const data_chunk& key, size_t repeats=zero,
+    bool negate=false)
+{
+    using namespace chain;
+    operations ops{};
+    for (size_t repeat{}; repeat < repeats; ++repeat)
+    {
+        ops.emplace_back(opcode::dup);
+        ops.emplace_back(data_chunk{ key }, false);
+        ops.emplace_back(opcode::checksig);
+        ops.emplace_back(opcode::verify);
+    }
+
+    ops.emplace_back(data_chunk{ key }, false);
+    ops.emplace_back(opcode::checksig);
+    if (negate)
+        ops.emplace_back(opcode::not_);
+
+    return script{ std::move(ops) };
+}
+
+// Tweak the spend key by the leaf, setting output key and control block.
+inline void commit_leaf(ec_xonly& out_key, data_chunk& control,
+    const chain::script& leaf)
+{
+    const auto internal = spend_point();
+    const auto leaf_hash = chain::taproot::leaf_hash(chain::tapscript_version,
+        leaf);
+
+    ec_compressed point{ spend_key() };
+    point.front() = ec_even_sign;
+    BOOST_REQUIRE(ec_add(point, tagged_hash("TapTweak",
+        splice(internal, leaf_hash))));
+
+    const auto parity = point.front() != ec_even_sign;
+    control = { parity ? add1(chain::tapscript_version) :
+        chain::tapscript_version };
+    control.insert(control.end(), internal.begin(), internal.end());
+    out_key = slice<one, ec_compressed_size>(point);
+}
+
+inline spend key_path_spend(bool bad_signature=false)
+{
+    spend item{ spend::type::key_path };
+    item.bad_signature = bad_signature;
+    return item;
+}
+
+inline spend script_path_spend(bool bad_signature=false,
+    bool bad_commitment=false)
+{
+    spend item{ spend::type::script_path,
+        checksig_leaf(to_chunk(spend_point())) };
+    item.bad_signature = bad_signature;
+    item.bad_commitment = bad_commitment;
+    return item;
+}
+
+inline spend key_hash_spend(bool bad_signature=false)
+{
+    spend item{ spend::type::key_hash };
+    item.bad_signature = bad_signature;
+    return item;
+}
+
+// Each spend is an input of the returned transaction, with prevout populated.
+// Signatures are created on a separate (unsigned) transaction so that the
+// returned transaction has no signature hash caches populated.
+inline chain::transaction signed_spender(const spends& items)
+{
+    using namespace chain;
+    const auto secret = spend_secret();
+    const auto key = spend_key();
+    const auto key_hash = bitcoin_short_hash(key);
+    const script subscript{ script::to_pay_key_hash_pattern(key_hash) };
+
+    outputs prevouts{};
+    inputs unsigned_inputs{};
+    std_vector<data_chunk> controls{};
+    for (uint32_t index{}; index < items.size(); ++index)
+    {
+        const auto& item = items.at(index);
+        const auto value = add1<uint64_t>(index);
+        ec_xonly out_key{ spend_point() };
+        data_chunk control{};
+
+        switch (item.kind)
+        {
+            case spend::type::key_path:
+                prevouts.emplace_back(value, taproot_script(out_key));
+                break;
+            case spend::type::script_path:
+                commit_leaf(out_key, control, item.leaf);
+                if (item.bad_commitment)
+                    out_key.back() ^= 1u;
+
+                prevouts.emplace_back(value, taproot_script(out_key));
+                break;
+            case spend::type::key_hash:
+                prevouts.emplace_back(value, script
+                {
+                    script::to_pay_witness_key_hash_pattern(key_hash)
+                });
+                break;
+        }
+
+        controls.push_back(std::move(control));
+        unsigned_inputs.emplace_back(point{ one_hash, index }, script{}, 0u);
+    }
+
+    const outputs outs{ { 0u, script{} } };
+    const transaction unsigned_tx{ 1u, std::move(unsigned_inputs), outs, 0u };
+    auto prevout = prevouts.begin();
+    for (const auto& input: *unsigned_tx.inputs_ptr())
+        input->prevout = to_shared<output>(*prevout++);
+
+    inputs ins{};
+    for (uint32_t index{}; index < items.size(); ++index)
+    {
+        const auto& item = items.at(index);
+        const auto& prevout_script = prevouts.at(index).script();
+        const auto value = prevouts.at(index).value();
+        const auto input = std::next(unsigned_tx.inputs_ptr()->begin(), index);
+        data_stack stack{};
+
+        if (item.kind == spend::type::key_hash)
+        {
+            endorsement out{};
+            BOOST_REQUIRE(unsigned_tx.create_endorsement(out, secret,
+                subscript, index, value, coverage::hash_all,
+                script_version::segwit, spend_flags));
+            stack.push_back(std::move(out));
+            stack.emplace_back(key.begin(), key.end());
+        }
+        else if (item.sign)
+        {
+            const auto key_path = item.kind == spend::type::key_path;
+            const auto tapleaf = key_path ? hash_cptr{} :
+                to_shared(taproot::leaf_hash(tapscript_version, item.leaf));
+
+            hash_digest sighash{};
+            ec_signature signature{};
+            BOOST_REQUIRE(unsigned_tx.signature_hash(sighash, input,
+                key_path ? prevout_script : item.leaf, value, tapleaf,
+                script_version::taproot, coverage::hash_default,
+                spend_flags));
+            BOOST_REQUIRE(schnorr::sign(signature, secret, sighash,
+                null_hash));
+            stack.emplace_back(signature.begin(), signature.end());
+        }
+
+        if (item.bad_signature)
+            stack.front().at(10) ^= 1u;
+
+        if (item.kind == spend::type::script_path)
+        {
+            stack.insert(stack.end(), item.stack.begin(), item.stack.end());
+            stack.push_back(item.leaf.to_data(false));
+            stack.push_back(controls.at(index));
+        }
+
+        ins.emplace_back(point{ one_hash, index }, script{},
+            witness{ std::move(stack) }, 0u);
+    }
+
+    const transaction tx{ 1u, std::move(ins), outs, 0u };
+    prevout = prevouts.begin();
+    for (const auto& input: *tx.inputs_ptr())
+        input->prevout = to_shared<output>(*prevout++);
+
+    return tx;
+}
+
+#endif
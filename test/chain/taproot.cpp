@@ -22,9 +22,79 @@ BOOST_AUTO_TEST_SUITE(taproot_tests)
 
 using namespace system::chain;
 
-BOOST_AUTO_TEST_CASE(taproot_test)
+// Commitment of the leaf to the internal key of the secret via the path.
+static taproot::commitment committed(uint8_t secret, const hash_digest& leaf,
+    const hashes& path)
 {
-    BOOST_REQUIRE(true);
+    auto root = leaf;
+    for (const auto& key: path)
+        root = tagged_hash("TapBranch", std::lexicographical_compare(
+            root.begin(), root.end(), key.begin(), key.end()) ?
+            splice(root, key) : splice(key, root));
+
+    // Internal key is the (even) x-only public key of the secret.
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, ec_secret{ secret }));
+    const auto internal = slice<one, ec_compressed_size>(point);
+    point.front() = ec_even_sign;
+
+    // Output key is the internal key tweaked by the root.
+    BOOST_REQUIRE(ec_add(point,
+        tagged_hash("TapTweak", splice(internal, root))));
+    const auto parity = point.front() != ec_even_sign;
+
+    data_chunk control{ parity ? add1(tapscript_version) : tapscript_version };
+    control.insert(control.end(), internal.begin(), internal.end());
+    for (const auto& key: path)
+        control.insert(control.end(), key.begin(), key.end());
+
+    return
+    {
+        tapscript{ to_shared(std::move(control)) },
+        slice<one, ec_compressed_size>(point),
+        leaf
+    };
+}
+
+static taproot::commitments commitments()
+{
+    taproot::commitments batch{};
+    hashes path{};
+    for (uint8_t index = 1; index < 20; ++index)
+    {
+        batch.push_back(committed(index, sha256_hash(to_array(index)), path));
+        path.push_back(sha256_hash(to_array(add1(index))));
+    }
+
+    return batch;
+}
+
+BOOST_AUTO_TEST_CASE(taproot__verify_commits__empty__zero)
+{
+    BOOST_REQUIRE_EQUAL(taproot::verify_commits({}), zero);
+}
+
+BOOST_AUTO_TEST_CASE(taproot__verify_commits__valid__count)
+{
+    const auto batch = commitments();
+    for (const auto& item: batch)
+        BOOST_REQUIRE(taproot::verify_commit(item.control, item.out_key,
+            item.leaf));
+
+    BOOST_REQUIRE_EQUAL(taproot::verify_commits(batch), batch.size());
+}
+
+BOOST_AUTO_TEST_CASE(taproot__verify_commits__invalid__first_invalid_index)
+{
+    auto batch = commitments();
+    batch.at(11).leaf.front() ^= 0x01;
+    batch.at(5).out_key.back() ^= 0x01;
+    BOOST_REQUIRE(!taproot::verify_commit(batch.at(5).control,
+        batch.at(5).out_key, batch.at(5).leaf));
+    BOOST_REQUIRE(!taproot::verify_commit(batch.at(11).control,
+        batch.at(11).out_key, batch.at(11).leaf));
+
+    BOOST_REQUIRE_EQUAL(taproot::verify_commits(batch), 5u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
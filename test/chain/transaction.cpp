@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "spender.hpp"
 
 BOOST_AUTO_TEST_SUITE(transaction_tests)
 
@@ -108,6 +109,7 @@ public:
     using transaction::is_relative_locked;
     using transaction::is_unconfirmed_spend;
     using transaction::is_confirmed_double_spend;
+    using transaction::is_sighash_complete;
 };
 
 // constructors
@@ -348,6 +350,54 @@ BOOST_AUTO_TEST_CASE(transaction__to_data__writer__expected)
     BOOST_REQUIRE(copy == tx);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__to_data__gather_nominal__expected)
+{
+    const transaction tx(tx1_data, true);
+    BOOST_REQUIRE(tx.is_valid());
+
+    gather sink{};
+    tx.to_data(sink);
+    BOOST_REQUIRE_EQUAL(sink.size(false), tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(sink.to_data(false), tx.to_data(false));
+    BOOST_REQUIRE_EQUAL(sink.to_data(true), tx.to_data(true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_data__gather_segregated__expected_selections)
+{
+    const transaction instance
+    {
+        2u,
+        inputs
+        {
+            { point{ one_hash, 0 }, script{ "[0102030405060708090a0b0c0d0e0f1011] drop" }, witness{ "[0102] [0102030405060708090a0b0c0d0e0f1011]" }, 42u },
+            { point{ one_hash, 1 }, script{}, witness{ "[0304]" }, 24u }
+        },
+        outputs
+        {
+            { 1000u, script{ "[0506] drop" } }
+        },
+        7u
+    };
+
+    // Deserialized scripts and witnesses retain their bytes (referenced).
+    const transaction tx(instance.to_data(true), true);
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx.is_segregated());
+
+    gather sink{};
+    tx.to_data(sink);
+    BOOST_REQUIRE_EQUAL(sink.size(false), tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(sink.size(true), tx.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(sink.to_data(false), tx.to_data(false));
+    BOOST_REQUIRE_EQUAL(sink.to_data(true), tx.to_data(true));
+
+    // Constructed (operation) scripts are encoded, with equal serialization.
+    gather constructed{};
+    instance.to_data(constructed);
+    BOOST_REQUIRE_EQUAL(constructed.to_data(false), instance.to_data(false));
+    BOOST_REQUIRE_EQUAL(constructed.to_data(true), instance.to_data(true));
+}
+
 // properties
 // ----------------------------------------------------------------------------
 
@@ -686,6 +736,330 @@ BOOST_AUTO_TEST_CASE(transaction__signature_operations__empty_input_output__zero
 // accept
 // connect
 
+// Each input spends a distinct prevout (prevouts are not shared across inputs).
+static transaction spender(const std_vector<opcode>& codes) NOEXCEPT
+{
+    inputs ins{};
+    for (uint32_t index{}; index < codes.size(); ++index)
+        ins.emplace_back(point{ tx1_hash, index }, script{}, 0u);
+
+    const transaction tx{ 1u, std::move(ins), outputs{ { 0u, script{} } }, 0u };
+
+    auto code = codes.begin();
+    for (const auto& input: *tx.inputs_ptr())
+        input->prevout = to_shared(output
+        {
+            0u, script{ operations{ { *code++ } } }
+        });
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_valid__success)
+{
+    const auto instance = spender(std_vector<opcode>(
+        100, opcode::push_positive_1));
+
+    BOOST_REQUIRE(!instance.connect({}, false));
+    BOOST_REQUIRE(!instance.connect({}, true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_single_failure__expected)
+{
+    const auto instance = spender({ opcode::op_return });
+    const auto expected = instance.connect({}, false);
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE_EQUAL(instance.connect({}, true), expected);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_failures__first_failure)
+{
+    std_vector<opcode> codes(100, opcode::push_positive_1);
+    codes[42] = opcode::push_size_0;
+    codes[84] = opcode::op_return;
+    const auto instance = spender(codes);
+
+    // Failures differ, and the first failure (in input order) is returned.
+    const auto expected = spender({ opcode::push_size_0 }).connect({});
+    BOOST_REQUIRE(expected);
+    BOOST_REQUIRE_NE(spender({ opcode::op_return }).connect({}), expected);
+    BOOST_REQUIRE_EQUAL(instance.connect({}, false), expected);
+    BOOST_REQUIRE_EQUAL(instance.connect({}, true), expected);
+}
+
+constexpr auto witness_flags = flags::bip16_rule | flags::bip141_rule |
+    flags::bip143_rule | flags::bip341_rule | flags::bip342_rule;
+
+// Signed spends alternating p2wpkh (version 0) and p2tr key path (version 1).
+// The prevout at missing is not populated and the signature at corrupt is
+// invalidated. Signatures are created on a separate (unsigned) transaction so
+// that the returned transaction has no signature hash caches populated.
+static transaction witness_spender(uint32_t count, uint32_t missing,
+    uint32_t corrupt)
+{
+    ec_secret secret{};
+    secret.back() = 42;
+    ec_compressed key{};
+    BOOST_REQUIRE(secret_to_public(key, secret));
+
+    hash_digest program{};
+    std::copy_n(std::next(key.begin()), ec_xonly_size, program.begin());
+    const auto key_hash = bitcoin_short_hash(key);
+    const script subscript{ script::to_pay_key_hash_pattern(key_hash) };
+
+    outputs prevouts{};
+    inputs unsigned_inputs{};
+    for (uint32_t index{}; index < count; ++index)
+    {
+        prevouts.emplace_back(add1<uint64_t>(index), script
+        {
+            is_odd(index) ? taproot_script(program) :
+                script::to_pay_witness_key_hash_pattern(key_hash)
+        });
+
+        unsigned_inputs.emplace_back(point{ tx1_hash, index }, script{}, 0u);
+    }
+
+    const outputs outs{ { 0u, script{} } };
+    const transaction unsigned_tx{ 1u, std::move(unsigned_inputs), outs, 0u };
+    auto prevout = prevouts.begin();
+    for (const auto& input: *unsigned_tx.inputs_ptr())
+        input->prevout = to_shared<output>(*prevout++);
+
+    inputs ins{};
+    for (uint32_t index{}; index < count; ++index)
+    {
+        const auto value = prevouts.at(index).value();
+        data_stack stack{};
+        if (is_odd(index))
+        {
+            hash_digest sighash{};
+            ec_signature signature{};
+            const auto input = std::next(unsigned_tx.inputs_ptr()->begin(),
+                index);
+            BOOST_REQUIRE(unsigned_tx.signature_hash(sighash, input,
+                prevouts.at(index).script(), value, {},
+                script_version::taproot, coverage::hash_default,
+                witness_flags));
+            BOOST_REQUIRE(schnorr::sign(signature, secret, sighash,
+                null_hash));
+            stack.emplace_back(signature.begin(), signature.end());
+        }
+        else
+        {
+            endorsement out{};
+            BOOST_REQUIRE(unsigned_tx.create_endorsement(out, secret,
+                subscript, index, value, coverage::hash_all,
+                script_version::segwit, witness_flags));
+            stack.push_back(std::move(out));
+            stack.emplace_back(key.begin(), key.end());
+        }
+
+        if (index == corrupt)
+            stack.front().at(10) ^= 1u;
+
+        ins.emplace_back(point{ tx1_hash, index }, script{},
+            witness{ std::move(stack) }, 0u);
+    }
+
+    const transaction tx{ 1u, std::move(ins), outs, 0u };
+    for (uint32_t index{}; index < count; ++index)
+        if (index != missing)
+            tx.inputs_ptr()->at(index)->prevout = to_shared<output>(
+                prevouts.at(index));
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_witness_valid__success)
+{
+    context ctx{};
+    ctx.flags = witness_flags;
+    BOOST_REQUIRE(!witness_spender(40, 40, 40).connect(ctx, false));
+    BOOST_REQUIRE(!witness_spender(40, 40, 40).connect(ctx, true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_witness_invalid__serial_result)
+{
+    context ctx{};
+    ctx.flags = witness_flags;
+    for (const auto corrupt: { 6u, 7u })
+    {
+        const auto expected = witness_spender(40, 40, corrupt).connect(ctx);
+        BOOST_REQUIRE(expected);
+        BOOST_REQUIRE_EQUAL(witness_spender(40, 40, corrupt).connect(ctx,
+            true), expected);
+    }
+}
+
+// Incomplete precompute (missing prevout) must not lazily populate taproot
+// signature hash caches concurrently (connect falls back to serial). Serial
+// connect fails at the first input, before any taproot signature hashing.
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_witness_missing_prevout__serial_result)
+{
+    context ctx{};
+    ctx.flags = witness_flags;
+    const auto expected = witness_spender(40, 0, 40).connect(ctx);
+    BOOST_REQUIRE_EQUAL(expected, error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(witness_spender(40, 0, 40).connect(ctx, true),
+        expected);
+}
+
+// Deferred (signature batch) verification must return the in place code.
+static code connect_batched(const transaction& tx, const context& ctx)
+{
+    machine::signature_batch batch{};
+    return batch.verify(tx.connect(ctx, batch));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batched_valid__success)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto tx = signed_spender(
+    {
+        key_path_spend(), script_path_spend(), key_hash_spend()
+    });
+
+    BOOST_REQUIRE_EQUAL(tx.connect(ctx), error::transaction_success);
+    BOOST_REQUIRE_EQUAL(connect_batched(tx, ctx), error::transaction_success);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batched_bad_signature__in_place_result)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto key_path = signed_spender(
+    {
+        key_hash_spend(), key_path_spend(true)
+    });
+
+    BOOST_REQUIRE_EQUAL(key_path.connect(ctx), error::stack_false);
+    BOOST_REQUIRE_EQUAL(connect_batched(key_path, ctx), error::stack_false);
+
+    const auto script_path = signed_spender(
+    {
+        key_hash_spend(), script_path_spend(true)
+    });
+
+    BOOST_REQUIRE_EQUAL(script_path.connect(ctx), error::op_check_sig_verify5);
+    BOOST_REQUIRE_EQUAL(connect_batched(script_path, ctx),
+        error::op_check_sig_verify5);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batched_bad_commitment__in_place_result)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto tx = signed_spender(
+    {
+        key_path_spend(), script_path_spend(false, true)
+    });
+
+    const auto expected = tx.connect(ctx);
+    BOOST_REQUIRE_EQUAL(expected, error::invalid_commitment);
+    BOOST_REQUIRE_EQUAL(connect_batched(tx, ctx), expected);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batched_deferred_then_in_place_failure__deferred_result)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    for (const auto& deferred: { key_path_spend(true), script_path_spend(true),
+        script_path_spend(false, true) })
+    {
+        // The in place (ecdsa) failure follows the deferred failure.
+        const auto tx = signed_spender({ deferred, key_hash_spend(true) });
+        const auto expected = signed_spender({ deferred }).connect(ctx);
+        BOOST_REQUIRE(expected);
+        BOOST_REQUIRE_EQUAL(tx.connect(ctx), expected);
+        BOOST_REQUIRE_EQUAL(connect_batched(tx, ctx), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__batched_in_place_then_deferred_failure__in_place_result)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    for (const auto& deferred: { key_path_spend(true), script_path_spend(true),
+        script_path_spend(false, true) })
+    {
+        // The deferred failure follows the in place (ecdsa) failure.
+        const auto tx = signed_spender({ key_hash_spend(true), deferred });
+        BOOST_REQUIRE_EQUAL(tx.connect(ctx), error::stack_false);
+        BOOST_REQUIRE_EQUAL(connect_batched(tx, ctx), error::stack_false);
+    }
+}
+
+// Cached (script cache) connect, with inputs (and prevouts) of the spender.
+static accessor cache_spender(const spends& items)
+{
+    const auto tx = signed_spender(items);
+    return { tx.version(), tx.inputs_ptr(), tx.outputs_ptr(), tx.locktime() };
+}
+
+static const auto cache_salt = base16_hash(
+    "0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20");
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_hit__skips_execution_and_precompute)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto tx = cache_spender({ key_path_spend(true), key_hash_spend(true) });
+    machine::script_cache cache{ 1024, cache_salt };
+    cache.store(tx.hash(true), 0, ctx.flags);
+    cache.store(tx.hash(true), 1, ctx.flags);
+
+    // Invalid inputs are not executed, and signature hashing is not started.
+    BOOST_REQUIRE_EQUAL(tx.connect(ctx, cache), error::transaction_success);
+    BOOST_REQUIRE(!tx.is_sighash_complete());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_miss__stored)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto tx = cache_spender(
+    {
+        key_path_spend(), script_path_spend(), key_hash_spend()
+    });
+
+    machine::script_cache cache{ 1024, cache_salt };
+    BOOST_REQUIRE_EQUAL(tx.connect(ctx, cache), error::transaction_success);
+    BOOST_REQUIRE(tx.is_sighash_complete());
+    BOOST_REQUIRE(cache.exists(tx.hash(true), 0, ctx.flags));
+    BOOST_REQUIRE(cache.exists(tx.hash(true), 1, ctx.flags));
+    BOOST_REQUIRE(cache.exists(tx.hash(true), 2, ctx.flags));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_failure__not_stored)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto tx = cache_spender({ key_hash_spend(), key_path_spend(true) });
+    machine::script_cache cache{ 1024, cache_salt };
+    BOOST_REQUIRE_EQUAL(tx.connect(ctx, cache), error::stack_false);
+    BOOST_REQUIRE(cache.exists(tx.hash(true), 0, ctx.flags));
+    BOOST_REQUIRE(!cache.exists(tx.hash(true), 1, ctx.flags));
+
+    // The failure is not cached, so is returned again.
+    BOOST_REQUIRE_EQUAL(tx.connect(ctx, cache), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__cache_different_flags__miss)
+{
+    context ctx{};
+    ctx.flags = spend_flags;
+    const auto tx = cache_spender({ key_path_spend(true) });
+    machine::script_cache cache{ 1024, cache_salt };
+    cache.store(tx.hash(true), 0, ctx.flags);
+
+    // Stored under other flags, so the input is executed (and fails).
+    ctx.flags = spend_flags | flags::bip65_rule;
+    BOOST_REQUIRE_EQUAL(tx.connect(ctx, cache), error::stack_false);
+    BOOST_REQUIRE(!cache.exists(tx.hash(true), 0, ctx.flags));
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
@@ -1419,4 +1793,94 @@ BOOST_AUTO_TEST_CASE(transaction__signature_hash__all__expected)
     BOOST_REQUIRE_EQUAL(sighash, expected);
 }
 
+
+// set_sighash_precompute
+
+static transaction sighash_transaction()
+{
+    const auto program = base16_chunk("5120"
+        "4242424242424242424242424242424242424242424242424242424242424242");
+
+    const transaction instance
+    {
+        2u,
+        inputs
+        {
+            { point{ one_hash, 0 }, script{}, witness{ "[0102]" }, 42u },
+            { point{ one_hash, 1 }, script{}, witness{ "[0304]" }, 24u }
+        },
+        outputs
+        {
+            { 1000u, script{ "[0506] drop" } },
+            { 2000u, script{ "[0708] drop" } }
+        },
+        7u
+    };
+
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_segregated());
+    instance.inputs_ptr()->front()->prevout = to_shared<output>(3000u, script{ program, false });
+    instance.inputs_ptr()->back()->prevout = to_shared<output>(4000u, script{ program, false });
+    return instance;
+}
+
+static const std_vector<uint8_t> sighash_flags
+{
+    0x00, 0x01, 0x02, 0x03, 0x81, 0x82, 0x83
+};
+
+BOOST_AUTO_TEST_CASE(transaction__set_sighash_precompute__version0__unchanged)
+{
+    constexpr auto flags = flags::bip143_rule;
+    const script subscript{ "[0506] drop" };
+    const hash_cptr tapleaf{};
+    const auto cached = sighash_transaction();
+    cached.set_sighash_precompute();
+
+    for (const auto sighash_flag: sighash_flags)
+    {
+        for (auto input = zero; input < two; ++input)
+        {
+            const auto instance = sighash_transaction();
+            const auto it = std::next(instance.inputs_ptr()->begin(), input);
+            const auto at = std::next(cached.inputs_ptr()->begin(), input);
+
+            hash_digest expected{};
+            hash_digest sighash{};
+            BOOST_REQUIRE(instance.signature_hash(expected, it, subscript, 1000u, tapleaf, script_version::segwit, sighash_flag, flags));
+            BOOST_REQUIRE(cached.signature_hash(sighash, at, subscript, 1000u, tapleaf, script_version::segwit, sighash_flag, flags));
+            BOOST_REQUIRE_EQUAL(sighash, expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__set_sighash_precompute__version1__unchanged)
+{
+    constexpr auto flags = flags::bip342_rule;
+    const script subscript{ "[0506] drop" };
+    const auto tapleaf = to_shared<hash_digest>(one_hash);
+    const auto cached = sighash_transaction();
+    cached.set_sighash_precompute();
+
+    for (const auto sighash_flag: sighash_flags)
+    {
+        for (auto input = zero; input < two; ++input)
+        {
+            const auto instance = sighash_transaction();
+            const auto it = std::next(instance.inputs_ptr()->begin(), input);
+            const auto at = std::next(cached.inputs_ptr()->begin(), input);
+
+            hash_digest expected{};
+            hash_digest sighash{};
+            BOOST_REQUIRE(instance.signature_hash(expected, it, subscript, 3000u, {}, script_version::taproot, sighash_flag, flags));
+            BOOST_REQUIRE(cached.signature_hash(sighash, at, subscript, 3000u, {}, script_version::taproot, sighash_flag, flags));
+            BOOST_REQUIRE_EQUAL(sighash, expected);
+
+            BOOST_REQUIRE(instance.signature_hash(expected, it, subscript, 3000u, tapleaf, script_version::taproot, sighash_flag, flags));
+            BOOST_REQUIRE(cached.signature_hash(sighash, at, subscript, 3000u, tapleaf, script_version::taproot, sighash_flag, flags));
+            BOOST_REQUIRE_EQUAL(sighash, expected);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
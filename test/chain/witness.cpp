@@ -204,4 +204,110 @@ BOOST_AUTO_TEST_CASE(witness__block__without_witness__checks)
     BOOST_REQUIRE(!instance.check());
 }
 
+// flat elements
+
+BOOST_AUTO_TEST_CASE(witness__deserialize__prefixed__contiguous_elements)
+{
+    const witness expected{ "[0102] [] [030405] [06]" };
+    const auto data = expected.to_data(true);
+    const witness instance(data, true);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE_EQUAL(instance.stack().size(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), data.size());
+    BOOST_REQUIRE_EQUAL(instance.to_data(true), data);
+
+    // Element bytes are contiguous, in stack order.
+    BOOST_REQUIRE_EQUAL(instance.element(0).size(), 2u);
+    BOOST_REQUIRE(instance.element(1).empty());
+    BOOST_REQUIRE_EQUAL(instance.element(2).size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.element(3).size(), 1u);
+    BOOST_REQUIRE_EQUAL(std::next(instance.element(0).data(), 2), instance.element(2).data());
+    BOOST_REQUIRE_EQUAL(std::next(instance.element(2).data(), 3), instance.element(3).data());
+    BOOST_REQUIRE_EQUAL(instance.element(2).data(), instance.stack().at(2)->data());
+}
+
+BOOST_AUTO_TEST_CASE(witness__deserialize__unprefixed__expected)
+{
+    const witness expected{ "[0102] [030405]" };
+    const witness instance(expected.to_data(false), false);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), expected.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(std::next(instance.element(0).data(), 2), instance.element(1).data());
+}
+
+BOOST_AUTO_TEST_CASE(witness__deserialize__truncated__invalid)
+{
+    auto data = witness{ "[0102] [030405]" }.to_data(true);
+    data.pop_back();
+    const witness instance(data, true);
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.stack().empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness__deserialize__empty_stack__invalid)
+{
+    const witness instance(data_chunk{ 0x00 }, true);
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE(instance.stack().empty());
+    BOOST_REQUIRE(instance.element(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness__deserialize__arena__allocations_independent_of_elements)
+{
+    const auto small = witness{ "[01] [02]" }.to_data(true);
+    const auto large = witness{ "[01] [02] [03] [04] [05] [06] [07] [08]" }.to_data(true);
+
+    test::reporting_arena<false> arena1{};
+    fast_reader source1(small, &arena1);
+    const witness instance1(source1, true);
+    BOOST_REQUIRE(instance1.is_valid());
+
+    test::reporting_arena<false> arena2{};
+    fast_reader source2(large, &arena2);
+    const witness instance2(source2, true);
+    BOOST_REQUIRE(instance2.is_valid());
+
+    BOOST_REQUIRE_EQUAL(arena1.inc_count, arena2.inc_count);
+}
+
+BOOST_AUTO_TEST_CASE(witness__copy__deserialized__shares_elements)
+{
+    const witness expected{ "[0102] [030405]" };
+    const auto copy = [&]() NOEXCEPT
+    {
+        // Elements outlive the original instance.
+        const witness instance(expected.to_data(true), true);
+        return instance;
+    }();
+
+    BOOST_REQUIRE(copy == expected);
+    BOOST_REQUIRE(copy.element(1) == expected.element(1));
+}
+
+// A stream buffer that cannot seek (as a pipe or socket).
+class forward_only
+  : public std::streambuf
+{
+public:
+    forward_only(data_chunk& data) NOEXCEPT
+    {
+        const auto begin = pointer_cast<char>(data.data());
+        setg(begin, begin, std::next(begin, data.size()));
+    }
+};
+
+BOOST_AUTO_TEST_CASE(witness__deserialize__non_seekable_istream__expected)
+{
+    const witness expected{ "[0102] [] [030405]" };
+    auto data = expected.to_data(true);
+    forward_only buffer{ data };
+    std::istream stream{ &buffer };
+    const witness instance(stream, true);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), data.size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
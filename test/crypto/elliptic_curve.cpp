@@ -213,4 +213,49 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__ec_multiply__expected)
     BOOST_REQUIRE_EQUAL(public1, public2);
 }
 
+// schnorr
+
+static schnorr::verification schnorr_verification(uint8_t seed)
+{
+    ec_secret secret{};
+    secret.back() = seed;
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    schnorr::verification out{};
+    std::copy_n(std::next(point.begin()), ec_xonly_size, out.point.begin());
+    out.hash = sha256_hash(data_chunk{ seed });
+    BOOST_REQUIRE(schnorr::sign(out.signature, secret, out.hash, null_hash));
+    return out;
+}
+
+static schnorr::verifications schnorr_verifications(size_t count)
+{
+    schnorr::verifications out{};
+    for (uint8_t seed = 1; seed <= count; ++seed)
+        out.push_back(schnorr_verification(seed));
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__schnorr_verify_signatures__empty__zero)
+{
+    BOOST_REQUIRE(is_zero(schnorr::verify_signatures({})));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__schnorr_verify_signatures__valid__count)
+{
+    const auto batch = schnorr_verifications(42);
+    BOOST_REQUIRE_EQUAL(schnorr::verify_signatures(batch), batch.size());
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__schnorr_verify_signatures__invalid__first_invalid)
+{
+    auto batch = schnorr_verifications(42);
+    batch.at(7).hash.front() ^= 1u;
+    batch.at(13).signature.front() ^= 1u;
+    batch.at(21).point.front() ^= 1u;
+    BOOST_REQUIRE_EQUAL(schnorr::verify_signatures(batch), 7u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(shared_window_tests)
+
+using window = shared_window<uint32_t>;
+
+window make_window(uint32_t count)
+{
+    window instance{};
+    for (uint32_t value = 0; value < count; ++value)
+        instance.push_back(value);
+
+    return instance;
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__construct__default__empty)
+{
+    const window instance{};
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE(instance.begin() == instance.end());
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__values__ordered)
+{
+    const auto instance = make_window(42);
+    BOOST_REQUIRE(!instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 42u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 41u);
+    BOOST_REQUIRE_EQUAL(instance[7], 7u);
+    BOOST_REQUIRE_EQUAL(*instance.crbegin(), 41u);
+    BOOST_REQUIRE_EQUAL(*std::next(instance.crbegin()), 40u);
+    BOOST_REQUIRE(std::is_sorted(instance.begin(), instance.end()));
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__pop_front__values__expected)
+{
+    auto instance = make_window(3);
+    instance.pop_front();
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.front(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.back(), 2u);
+    instance.pop_front();
+    instance.pop_front();
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__copy_at_tip__shares_buffer)
+{
+    const auto parent = make_window(10);
+    auto child = parent;
+    child.push_back(10);
+    child.pop_front();
+
+    // The parent view is unchanged and the child extends its buffer in place.
+    BOOST_REQUIRE_EQUAL(parent.size(), 10u);
+    BOOST_REQUIRE_EQUAL(parent.back(), 9u);
+    BOOST_REQUIRE_EQUAL(child.size(), 10u);
+    BOOST_REQUIRE_EQUAL(child.front(), 1u);
+    BOOST_REQUIRE_EQUAL(child.back(), 10u);
+    BOOST_REQUIRE_EQUAL(&child.front(), &parent[1]);
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__divergent_copies__independent)
+{
+    const auto parent = make_window(10);
+    auto first = parent;
+    auto second = parent;
+    first.push_back(42);
+    second.push_back(24);
+
+    // The second push is not at the buffer tip, so it is reallocated.
+    BOOST_REQUIRE_EQUAL(parent.size(), 10u);
+    BOOST_REQUIRE_EQUAL(parent.back(), 9u);
+    BOOST_REQUIRE_EQUAL(first.back(), 42u);
+    BOOST_REQUIRE_EQUAL(second.back(), 24u);
+    BOOST_REQUIRE_EQUAL(&first.front(), &parent.front());
+    BOOST_REQUIRE_NE(&second.front(), &parent.front());
+    BOOST_REQUIRE(std::equal(parent.begin(), parent.end(), second.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(shared_window__push_back__sliding_lineage__bounded_capacity)
+{
+    constexpr auto count = 11u;
+    std_vector<window> lineage{ make_window(count) };
+    for (uint32_t value = count; value < 1000u; ++value)
+    {
+        auto next = lineage.back();
+        next.push_back(value);
+        next.pop_front();
+        lineage.push_back(next);
+    }
+
+    // Each derived window is an unchanged view of the same values.
+    for (size_t index = 0; index < lineage.size(); ++index)
+    {
+        const auto& item = lineage.at(index);
+        BOOST_REQUIRE_EQUAL(item.size(), count);
+        BOOST_REQUIRE_EQUAL(item.front(), index);
+        BOOST_REQUIRE_EQUAL(item.back(), index + count - 1u);
+        BOOST_REQUIRE_LE(item.capacity(), 2u * (count + 1u));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,4 +26,104 @@ BOOST_AUTO_TEST_CASE(golomb_test)
     BOOST_REQUIRE(true);
 }
 
+constexpr uint8_t golomb_bits = 19;
+constexpr uint64_t golomb_rate = 784931;
+constexpr siphash_key golomb_key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+
+static data_stack golomb_items(size_t count, uint8_t salt)
+{
+    data_stack items{};
+    items.reserve(count);
+    for (size_t index = 0; index < count; ++index)
+        items.push_back(to_chunk(sha256_hash(to_little_endian(
+            possible_narrow_cast<uint32_t>(index) + salt))));
+
+    return items;
+}
+
+// construct
+
+BOOST_AUTO_TEST_CASE(golomb__construct__small_set__all_items_match)
+{
+    const auto items = golomb_items(10, 0);
+    const auto set = golomb::construct(items, golomb_bits, golomb_key, golomb_rate);
+    BOOST_REQUIRE(!set.empty());
+
+    for (const auto& item: items)
+        BOOST_REQUIRE(golomb::match_single(set, item, items.size(),
+            golomb_key, golomb_bits, golomb_rate));
+}
+
+BOOST_AUTO_TEST_CASE(golomb__construct__concurrent_radix_set__all_items_match)
+{
+    const auto items = golomb_items(2000, 0);
+    const auto set = golomb::construct(items, golomb_bits, golomb_key, golomb_rate);
+    BOOST_REQUIRE(golomb::match_stack(set, items, items.size(), golomb_key,
+        golomb_bits, golomb_rate));
+
+    // Each single match requires ascending order of the encoded set.
+    for (size_t index = 0; index < items.size(); index += 97)
+        BOOST_REQUIRE(golomb::match_single(set, items.at(index), items.size(),
+            golomb_key, golomb_bits, golomb_rate));
+}
+
+BOOST_AUTO_TEST_CASE(golomb__construct__concurrent_radix_set__non_items_do_not_match)
+{
+    const auto items = golomb_items(2000, 0);
+    const auto set = golomb::construct(items, golomb_bits, golomb_key, golomb_rate);
+    const data_stack others{ to_chunk(null_hash), to_chunk(one_hash) };
+    BOOST_REQUIRE(!golomb::match_stack(set, others, items.size(), golomb_key,
+        golomb_bits, golomb_rate));
+}
+
+// match_many
+
+BOOST_AUTO_TEST_CASE(golomb__match_many__empty_sets__empty)
+{
+    BOOST_REQUIRE(golomb::match_many({}, golomb_items(3, 0), golomb_bits,
+        golomb_rate).empty());
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_many__empty_targets__no_matches)
+{
+    const auto items = golomb_items(100, 0);
+    const auto set = golomb::construct(items, golomb_bits, golomb_key, golomb_rate);
+    const golomb::compressed_sets sets{ { set, items.size(), golomb_key } };
+    const auto matches = golomb::match_many(sets, {}, golomb_bits, golomb_rate);
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+    BOOST_REQUIRE(!matches.front());
+}
+
+BOOST_AUTO_TEST_CASE(golomb__match_many__distinct_sets__expected_matches)
+{
+    constexpr siphash_key other_key{ 42, 24 };
+    const auto items1 = golomb_items(100, 0);
+    const auto items2 = golomb_items(300, 100);
+    const auto items3 = golomb_items(50, 100);
+    const auto set1 = golomb::construct(items1, golomb_bits, golomb_key, golomb_rate);
+    const auto set2 = golomb::construct(items2, golomb_bits, other_key, golomb_rate);
+    const auto set3 = golomb::construct(items3, golomb_bits, golomb_key, golomb_rate);
+    const golomb::compressed_sets sets
+    {
+        { set1, items1.size(), golomb_key },
+        { set2, items2.size(), other_key },
+        { set3, items3.size(), golomb_key }
+    };
+
+    // Duplicated targets are deduplicated, items1 are not in other sets.
+    const data_stack targets{ items1.at(50), items1.at(50), to_chunk(null_hash) };
+    const auto matches = golomb::match_many(sets, targets, golomb_bits, golomb_rate);
+    BOOST_REQUIRE_EQUAL(matches.size(), 3u);
+    BOOST_REQUIRE(matches.at(0));
+    BOOST_REQUIRE(!matches.at(1));
+    BOOST_REQUIRE(!matches.at(2));
+
+    // items3 are also in items2, but not in items1.
+    const data_stack shared{ items3.at(0) };
+    const auto shared_matches = golomb::match_many(sets, shared, golomb_bits, golomb_rate);
+    BOOST_REQUIRE(!shared_matches.at(0));
+    BOOST_REQUIRE(shared_matches.at(1));
+    BOOST_REQUIRE(shared_matches.at(2));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -295,6 +295,20 @@ BOOST_AUTO_TEST_CASE(functions__bitcoin_short__null_one__expected)
     BOOST_CHECK_EQUAL(bitcoin_short_chunk(to_chunk(null_hash)), to_chunk(expected));
 }
 
+BOOST_AUTO_TEST_CASE(functions__bitcoin_short_hash_batch__keys__expected)
+{
+    std::vector<data_chunk> keys{};
+    for (size_t index = 0; index < 21; ++index)
+        keys.emplace_back(is_odd(index) ? 33_size : 65_size,
+            static_cast<uint8_t>(index));
+
+    const auto hashes = bitcoin_short_hash_batch({ keys.begin(), keys.end() });
+    BOOST_REQUIRE_EQUAL(hashes.size(), keys.size());
+
+    for (size_t index = 0; index < keys.size(); ++index)
+        BOOST_CHECK_EQUAL(hashes[index], bitcoin_short_hash(keys[index]));
+}
+
 // bitcoin_hash
 // ----------------------------------------------------------------------------
 
@@ -327,6 +341,39 @@ BOOST_AUTO_TEST_CASE(tagged_hash_test)
     BOOST_REQUIRE_EQUAL(tagged_hash("tag", "msg"), expected);
 }
 
+BOOST_AUTO_TEST_CASE(tagged_hash__template__expected)
+{
+    // Test vector from secp256k1.
+    constexpr auto expected = base16_array("047a5e17b58647c13cc6ebc0aa583b62fb1643326877406ce276559a3bde55b3");
+    BOOST_REQUIRE_EQUAL(tagged_hash<"tag">("msg"), expected);
+}
+
+BOOST_AUTO_TEST_CASE(tagged_hash__standard_tags__expected)
+{
+    const auto expected = [](const std::string& tag, const data_slice& message)
+    {
+        const auto hash = sha256_hash(tag);
+        accumulator<sha256> context{};
+        context.write(hash);
+        context.write(hash);
+        context.write(message.size(), message.data());
+        return context.flush();
+    };
+
+    const auto message = base16_chunk("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f40");
+    for (const auto& tag:
+    {
+        "BIP0340/challenge", "BIP0340/aux", "BIP0340/nonce", "TapLeaf",
+        "TapBranch", "TapTweak", "TapSighash"
+    })
+    {
+        BOOST_REQUIRE_EQUAL(tagged_hash(tag, message), expected(tag, message));
+    }
+
+    BOOST_REQUIRE_EQUAL(tagged_hash<"TapLeaf">(message), expected("TapLeaf", message));
+    BOOST_REQUIRE_EQUAL(tagged_hash<"TapSighash">(message), expected("TapSighash", message));
+}
+
 // merkle_root
 // ----------------------------------------------------------------------------
 
@@ -67,6 +67,59 @@ BOOST_AUTO_TEST_CASE(rmd__rmd160_hash__test_vectors__expected)
     }
 }
 
+// hash_batch
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hash_batch__halves__expected)
+{
+    // Odd count exercises all lane widths and the serial remainder.
+    rmd160::halves_t halves(37);
+    for (size_t index = 0; index < halves.size(); ++index)
+        halves[index].fill(static_cast<uint8_t>(index));
+
+    const auto digests = rmd160::hash_batch(halves);
+    BOOST_REQUIRE_EQUAL(digests.size(), halves.size());
+
+    for (size_t index = 0; index < halves.size(); ++index)
+        BOOST_CHECK_EQUAL(digests[index], rmd160::hash(halves[index]));
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hash_batch__slices__expected)
+{
+    // Sizes span one to three padded blocks, including 32/33 byte keys.
+    std::vector<data_chunk> messages{};
+    for (size_t size = 0; size < 37; ++size)
+        messages.emplace_back(size * 4_size, static_cast<uint8_t>(size));
+
+    messages.emplace_back(33_size, 0x02_u8);
+    const rmd160::slices_t slices(messages.begin(), messages.end());
+    const auto digests = rmd160::hash_batch(slices);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_CHECK_EQUAL(digests[index], rmd160_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd128_hash_batch__slices__expected)
+{
+    std::vector<data_chunk> messages{};
+    for (size_t size = 0; size < 21; ++size)
+        messages.emplace_back(size * 7_size, static_cast<uint8_t>(size));
+
+    const rmd128::slices_t slices(messages.begin(), messages.end());
+    const auto digests = rmd128::hash_batch(slices);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_CHECK_EQUAL(digests[index], rmd128_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hash_batch__empty__empty)
+{
+    BOOST_REQUIRE(rmd160::hash_batch(rmd160::halves_t{}).empty());
+    BOOST_REQUIRE(rmd160::hash_batch(rmd160::slices_t{}).empty());
+}
+
 // Verify types.
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,326 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(sha_dispatch_tests)
+
+using sha_normal = sha::algorithm<sha::h256<>, false, false, false>;
+constexpr auto blocks = 37_size;
+constexpr auto block_size = array_count<sha_normal::block_t>;
+constexpr auto digest_size = array_count<sha_normal::digest_t>;
+
+static data_chunk get_data() NOEXCEPT
+{
+    data_chunk data(blocks * block_size);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = narrow_cast<uint8_t>(index * 7u);
+
+    return data;
+}
+
+static bool is_expected_iterate(const sha::kernels& kernels) NOEXCEPT
+{
+    const auto data = get_data();
+    auto state = sha::h256<>::get;
+    auto expected = sha::h256<>::get;
+    kernels.iterate(state, blocks, data.data());
+    sha_normal::accumulate(expected,
+        sha_normal::iblocks_t{ data.size(), data.data() });
+    return state == expected;
+}
+
+static bool is_expected_merkle(const sha::kernels& kernels) NOEXCEPT
+{
+    const auto data = get_data();
+    auto digests = data;
+    kernels.merkle(digests.data(), blocks);
+
+    for (size_t pair = 0; pair < blocks; ++pair)
+    {
+        sha_normal::block_t block{};
+        std::copy_n(std::next(data.begin(), pair * block_size), block_size,
+            block.begin());
+
+        const auto expected = sha_normal::double_hash(block);
+        if (!std::equal(expected.begin(), expected.end(),
+            std::next(digests.begin(), pair * digest_size)))
+            return false;
+    }
+
+    return true;
+}
+
+static bool is_expected_batch(const sha::kernels& kernels,
+    bool double_hash) NOEXCEPT
+{
+    // Varied lengths (including empty and whole blocks) span lane sets.
+    const auto data = get_data();
+    sha::kernels::slices_t messages{};
+    for (size_t index = 0; index < 41u; ++index)
+        messages.emplace_back(data.data(), std::next(data.data(),
+            (index * 29u) % data.size()));
+
+    // Midstate of one block prefix.
+    auto midstate = sha::h256<>::get;
+    sha_normal::accumulate(midstate,
+        sha_normal::iblocks_t{ block_size, data.data() });
+
+    sha::kernels::digests_t digests{};
+    kernels.batch(digests, midstate, block_size, messages, double_hash);
+    if (digests.size() != messages.size())
+        return false;
+
+    for (size_t index = 0; index < messages.size(); ++index)
+    {
+        // Expected is the hash of the prefix block and the message.
+        data_chunk message(data.begin(), std::next(data.begin(), block_size));
+        message.insert(message.end(), messages[index].begin(),
+            messages[index].end());
+
+        auto expected = accumulator<sha_normal>::hash(message);
+        if (double_hash)
+            expected = accumulator<sha_normal>::hash(expected);
+
+        if (digests[index] != expected)
+            return false;
+    }
+
+    return true;
+}
+
+static bool is_expected_rmd_halves(const sha::kernels& kernels) NOEXCEPT
+{
+    // Count spans all lane sets and a remainder.
+    const auto data = get_data();
+    sha::kernels::halves_t halves(43);
+    for (size_t index = 0; index < halves.size(); ++index)
+        std::copy_n(std::next(data.begin(), index * 13u), halves[index].size(),
+            halves[index].begin());
+
+    sha::kernels::short_digests_t digests{};
+    kernels.rmd_halves(digests, halves);
+    if (digests.size() != halves.size())
+        return false;
+
+    for (size_t index = 0; index < halves.size(); ++index)
+        if (digests[index] != rmd160::hash(halves[index]))
+            return false;
+
+    return true;
+}
+
+static bool is_expected_rmd_batch(const sha::kernels& kernels) NOEXCEPT
+{
+    // Varied lengths (including empty and whole blocks) span lane sets.
+    const auto data = get_data();
+    sha::kernels::slices_t messages{};
+    for (size_t index = 0; index < 41u; ++index)
+        messages.emplace_back(data.data(), std::next(data.data(),
+            (index * 29u) % data.size()));
+
+    sha::kernels::short_digests_t digests{};
+    kernels.rmd_batch(digests, messages);
+    if (digests.size() != messages.size())
+        return false;
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        if (digests[index] != rmd160_hash(messages[index].to_chunk()))
+            return false;
+
+    return true;
+}
+
+static bool is_expected_sip_batch(const sha::kernels& kernels) NOEXCEPT
+{
+    // Varied lengths (including empty and whole words) span lane sets.
+    const auto data = get_data();
+    sha::kernels::slices_t messages{};
+    for (size_t index = 0; index < 41u; ++index)
+        messages.emplace_back(data.data(), std::next(data.data(),
+            (index * 5u) % data.size()));
+
+    const sha::kernels::sip_key_t key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+    sha::kernels::sip_hashes_t hashes{};
+    kernels.sip_batch(hashes, key, messages);
+    if (hashes.size() != messages.size())
+        return false;
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        if (hashes[index] != siphash(key, messages[index]))
+            return false;
+
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__dispatch__portable__portable)
+{
+    const auto kernels = sha::dispatch(sha::kernel::portable);
+    BOOST_REQUIRE(kernels.iterate_set == sha::kernel::portable);
+    BOOST_REQUIRE(kernels.merkle_set == sha::kernel::portable);
+    BOOST_REQUIRE(kernels.batch_set == sha::kernel::portable);
+    BOOST_REQUIRE(kernels.rmd_set == sha::kernel::portable);
+    BOOST_REQUIRE(kernels.sip_set == sha::kernel::portable);
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__dispatch__available__expected_set)
+{
+    BOOST_REQUIRE((sha::dispatch(sha::kernel::avx2).iterate_set ==
+        sha::kernel::avx2) == (have_dispatch && try_avx2()));
+    BOOST_REQUIRE((sha::dispatch(sha::kernel::avx512).iterate_set ==
+        sha::kernel::avx512) == (have_dispatch && try_avx512()));
+    BOOST_REQUIRE((sha::dispatch(sha::kernel::native).iterate_set ==
+        sha::kernel::native) == (have_dispatch && try_shani()));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__dispatch__selected__preferred_sets)
+{
+    const auto& kernels = sha::dispatch();
+    const auto native = sha::dispatch(sha::kernel::native).iterate_set;
+    const auto avx512 = sha::dispatch(sha::kernel::avx512).merkle_set;
+    BOOST_REQUIRE(&kernels == &sha::dispatch());
+
+    if (native == sha::kernel::native)
+        BOOST_REQUIRE(kernels.iterate_set == sha::kernel::native);
+
+    if (avx512 == sha::kernel::avx512)
+        BOOST_REQUIRE(kernels.merkle_set == sha::kernel::avx512);
+
+    BOOST_REQUIRE(kernels.batch_set == kernels.merkle_set);
+
+    if (avx512 == sha::kernel::avx512)
+        BOOST_REQUIRE(kernels.rmd_set == sha::kernel::avx512);
+
+    BOOST_REQUIRE(kernels.sip_set == kernels.rmd_set);
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__iterate__all_sets__expected)
+{
+    BOOST_REQUIRE(is_expected_iterate(sha::dispatch()));
+    BOOST_REQUIRE(is_expected_iterate(sha::dispatch(sha::kernel::portable)));
+    BOOST_REQUIRE(is_expected_iterate(sha::dispatch(sha::kernel::avx2)));
+    BOOST_REQUIRE(is_expected_iterate(sha::dispatch(sha::kernel::avx512)));
+    BOOST_REQUIRE(is_expected_iterate(sha::dispatch(sha::kernel::native)));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__merkle__all_sets__expected)
+{
+    BOOST_REQUIRE(is_expected_merkle(sha::dispatch()));
+    BOOST_REQUIRE(is_expected_merkle(sha::dispatch(sha::kernel::portable)));
+    BOOST_REQUIRE(is_expected_merkle(sha::dispatch(sha::kernel::avx2)));
+    BOOST_REQUIRE(is_expected_merkle(sha::dispatch(sha::kernel::avx512)));
+    BOOST_REQUIRE(is_expected_merkle(sha::dispatch(sha::kernel::native)));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__batch__all_sets__expected)
+{
+    for (const auto double_hash: { false, true })
+    {
+        BOOST_REQUIRE(is_expected_batch(sha::dispatch(), double_hash));
+        BOOST_REQUIRE(is_expected_batch(sha::dispatch(sha::kernel::portable), double_hash));
+        BOOST_REQUIRE(is_expected_batch(sha::dispatch(sha::kernel::avx2), double_hash));
+        BOOST_REQUIRE(is_expected_batch(sha::dispatch(sha::kernel::avx512), double_hash));
+        BOOST_REQUIRE(is_expected_batch(sha::dispatch(sha::kernel::native), double_hash));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__rmd_halves__all_sets__expected)
+{
+    BOOST_REQUIRE(is_expected_rmd_halves(sha::dispatch()));
+    BOOST_REQUIRE(is_expected_rmd_halves(sha::dispatch(sha::kernel::portable)));
+    BOOST_REQUIRE(is_expected_rmd_halves(sha::dispatch(sha::kernel::avx2)));
+    BOOST_REQUIRE(is_expected_rmd_halves(sha::dispatch(sha::kernel::avx512)));
+    BOOST_REQUIRE(is_expected_rmd_halves(sha::dispatch(sha::kernel::native)));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__rmd_batch__all_sets__expected)
+{
+    BOOST_REQUIRE(is_expected_rmd_batch(sha::dispatch()));
+    BOOST_REQUIRE(is_expected_rmd_batch(sha::dispatch(sha::kernel::portable)));
+    BOOST_REQUIRE(is_expected_rmd_batch(sha::dispatch(sha::kernel::avx2)));
+    BOOST_REQUIRE(is_expected_rmd_batch(sha::dispatch(sha::kernel::avx512)));
+    BOOST_REQUIRE(is_expected_rmd_batch(sha::dispatch(sha::kernel::native)));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__sip_batch__all_sets__expected)
+{
+    BOOST_REQUIRE(is_expected_sip_batch(sha::dispatch()));
+    BOOST_REQUIRE(is_expected_sip_batch(sha::dispatch(sha::kernel::portable)));
+    BOOST_REQUIRE(is_expected_sip_batch(sha::dispatch(sha::kernel::avx2)));
+    BOOST_REQUIRE(is_expected_sip_batch(sha::dispatch(sha::kernel::avx512)));
+    BOOST_REQUIRE(is_expected_sip_batch(sha::dispatch(sha::kernel::native)));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__sha256_merkle_root__dispatched__expected)
+{
+    sha256::digests_t leaves(33);
+    for (size_t index = 0; index < leaves.size(); ++index)
+        leaves[index] = sha256_hash(data_chunk(index, narrow_cast<uint8_t>(index)));
+
+    auto copy = leaves;
+    BOOST_REQUIRE_EQUAL(sha256::merkle_root(std::move(leaves)),
+        sha_normal::merkle_root(std::move(copy)));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__sha256_double_hash_batch__dispatched__expected)
+{
+    const auto data = get_data();
+    sha256::slices_t messages{};
+    for (size_t index = 0; index < 37u; ++index)
+        messages.emplace_back(data.data(), std::next(data.data(), index * 3u));
+
+    BOOST_REQUIRE(sha256::double_hash_batch(messages) ==
+        sha_normal::double_hash_batch(messages));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__bitcoin_short_hash_batch__dispatched__expected)
+{
+    const auto data = get_data();
+    std::vector<data_slice> messages{};
+    for (size_t index = 0; index < 37u; ++index)
+        messages.emplace_back(data.data(), std::next(data.data(), index * 3u));
+
+    const auto hashes = bitcoin_short_hash_batch(messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], bitcoin_short_hash(messages[index].to_chunk()));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__siphash_batch__dispatched__expected)
+{
+    const auto data = get_data();
+    std::vector<data_slice> messages{};
+    for (size_t index = 0; index < 37u; ++index)
+        messages.emplace_back(data.data(), std::next(data.data(), index * 3u));
+
+    const siphash_key key{ 42u, 24u };
+    const auto hashes = siphash_batch(key, messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], siphash(key, messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__sha256_hash__dispatched__expected)
+{
+    const auto data = get_data();
+    BOOST_REQUIRE_EQUAL(sha256_hash(data), accumulator<sha_normal>::hash(data));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -182,4 +182,73 @@ BOOST_AUTO_TEST_CASE(vector__sha512__scheduling__expected)
     BOOST_CHECK_EQUAL(hashn, sha512v::hash(blocks));
 }
 
+// Batch
+// ----------------------------------------------------------------------------
+
+// Lane sets of 16/8/4 (as available) with sequential remainder, including
+// messages that pad to one, two and three blocks.
+static std::vector<data_chunk> batch_messages() NOEXCEPT
+{
+    std::vector<data_chunk> messages{};
+    for (size_t size = 0; size < 37; ++size)
+        messages.emplace_back(size * 5_size, static_cast<uint8_t>(size));
+
+    return messages;
+}
+
+BOOST_AUTO_TEST_CASE(vector__sha256__hash_batch__expected)
+{
+    using sha_256 = sha::algorithm<sha::h256<>, true, true, true>;
+    const auto messages = batch_messages();
+    const sha_256::slices_t slices(messages.begin(), messages.end());
+    const auto digests = sha_256::hash_batch(slices);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_CHECK_EQUAL(digests[index], sha256_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(vector__sha256__double_hash_batch__expected)
+{
+    using sha_256 = sha::algorithm<sha::h256<>, true, true, true>;
+    const auto messages = batch_messages();
+    const sha_256::slices_t slices(messages.begin(), messages.end());
+    const auto digests = sha_256::double_hash_batch(slices);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_CHECK_EQUAL(digests[index], bitcoin_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(vector__sha512__hash_batch__expected)
+{
+    using sha_512 = sha::algorithm<sha::h512<>, true, true, true>;
+    const auto messages = batch_messages();
+    const sha_512::slices_t slices(messages.begin(), messages.end());
+    const auto digests = sha_512::hash_batch(slices);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_CHECK_EQUAL(digests[index], sha512_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(vector__sha256__hash_batch_midstate__expected)
+{
+    using sha_256 = sha::algorithm<sha::h256<>, true, true, true>;
+    const auto messages = batch_messages();
+    const sha_256::slices_t slices(messages.begin(), messages.end());
+    const auto tag = sha256_hash(std::string{ "tag" });
+    const auto midstate = sha_256::midstate(tag, tag);
+    const auto digests = sha_256::hash_batch(midstate, one, slices);
+    BOOST_REQUIRE_EQUAL(digests.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_CHECK_EQUAL(digests[index], tagged_hash("tag", messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(vector__sha256__hash_batch_empty__empty)
+{
+    BOOST_REQUIRE(sha256::hash_batch({}).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -74,4 +74,55 @@ BOOST_AUTO_TEST_CASE(siphash__key__vectors__expected)
     }
 }
 
+// siphash_batch
+
+BOOST_AUTO_TEST_CASE(siphash__batch__empty__empty)
+{
+    BOOST_REQUIRE(siphash_batch({}, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__vectors__expected)
+{
+    half_hash hash{};
+    BOOST_REQUIRE(decode_base16(hash, hash_test_key));
+
+    const auto key = to_siphash_key(hash);
+    data_stack messages{};
+    std::vector<uint64_t> expected{};
+
+    for (const auto& result: siphash_hash_tests)
+    {
+        data_chunk data;
+        BOOST_REQUIRE(decode_base16(data, result.message));
+
+        data_chunk encoded_expected;
+        BOOST_REQUIRE(decode_base16(encoded_expected, result.result));
+
+        messages.push_back(data);
+        expected.push_back(from_little_endian<uint64_t>(encoded_expected));
+    }
+
+    const std::vector<data_slice> slices(messages.begin(), messages.end());
+    const auto hashes = siphash_batch(key, slices);
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(hashes.begin(), hashes.end(),
+        expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__mixed_lengths__expected)
+{
+    constexpr siphash_key key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+    data_stack messages{};
+
+    // Descending and repeated lengths exercise lane ordering and remainders.
+    for (size_t index = 0; index < 37; ++index)
+        messages.emplace_back((index * 7u) % 41u, narrow_cast<uint8_t>(index));
+
+    const std::vector<data_slice> slices(messages.begin(), messages.end());
+    const auto hashes = siphash_batch(key, slices);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes.at(index), siphash(key, messages.at(index)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
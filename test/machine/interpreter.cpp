@@ -17,12 +17,138 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "../chain/spender.hpp"
 
 BOOST_AUTO_TEST_SUITE(interpreter_tests)
 
+using namespace system::machine;
+
 BOOST_AUTO_TEST_CASE(interpreter_test)
 {
     BOOST_REQUIRE(true);
 }
 
+// Connect the first input in place.
+static code connect(const chain::transaction& tx)
+{
+    chain::context ctx{};
+    ctx.flags = spend_flags;
+    return interpreter<flat_stack>::connect(ctx, tx, tx.inputs_ptr()->begin());
+}
+
+// Connect the first input with deferral, and verify the deferrals.
+static code connect_batched(const chain::transaction& tx)
+{
+    chain::context ctx{};
+    ctx.flags = spend_flags;
+    signature_batch batch{};
+    return batch.verify(interpreter<flat_stack>::connect(ctx, tx,
+        tx.inputs_ptr()->begin(), batch));
+}
+
+// Tapscript (script path) spend of leaf, with a signature if sign.
+static chain::transaction tapscript_spender(const chain::script& leaf,
+    bool sign, bool bad_signature=false, const data_stack& stack={})
+{
+    spend item{ spend::type::script_path, leaf, stack, sign };
+    item.bad_signature = bad_signature;
+    return signed_spender({ item });
+}
+
+// tapscript op_check_sig
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_valid__success)
+{
+    const auto key = to_chunk(spend_point());
+    const auto tx = tapscript_spender(checksig_leaf(key), true);
+    BOOST_REQUIRE_EQUAL(connect(tx), error::script_success);
+    BOOST_REQUIRE_EQUAL(connect_batched(tx), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_batched__deferred)
+{
+    // The invalid signature (as valid) and the commitment are deferred.
+    chain::context ctx{};
+    ctx.flags = spend_flags;
+    signature_batch batch{};
+    const auto key = to_chunk(spend_point());
+    const auto tx = tapscript_spender(checksig_leaf(key), true, true);
+    BOOST_REQUIRE_EQUAL(interpreter<flat_stack>::connect(ctx, tx,
+        tx.inputs_ptr()->begin(), batch), error::script_success);
+    BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::script_success),
+        error::op_check_sig_verify5);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_empty_signature__pushes_false)
+{
+    const auto key = to_chunk(spend_point());
+    const auto tx = tapscript_spender(checksig_leaf(key), false, false, { {} });
+    BOOST_REQUIRE_EQUAL(connect(tx), error::stack_false);
+    BOOST_REQUIRE_EQUAL(connect_batched(tx), error::stack_false);
+
+    const auto negated = tapscript_spender(checksig_leaf(key, zero, true),
+        false, false, { {} });
+    BOOST_REQUIRE_EQUAL(connect(negated), error::script_success);
+    BOOST_REQUIRE_EQUAL(connect_batched(negated), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_invalid_signature__terminal)
+{
+    // A non-empty invalid signature does not push false (which is negated).
+    const auto key = to_chunk(spend_point());
+    const auto tx = tapscript_spender(checksig_leaf(key, zero, true), true,
+        true);
+    BOOST_REQUIRE_EQUAL(connect(tx), error::op_check_sig_verify5);
+    BOOST_REQUIRE_EQUAL(connect_batched(tx), error::op_check_sig_verify5);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_invalid_sighash_type__terminal)
+{
+    // An endorsement of neither 64 nor 65 bytes has invalid sighash type.
+    const auto key = to_chunk(spend_point());
+    const auto tx = tapscript_spender(checksig_leaf(key, zero, true), false,
+        false, { data_chunk(66u, 0x42u) });
+    BOOST_REQUIRE_EQUAL(connect(tx), error::op_check_sig_verify3);
+    BOOST_REQUIRE_EQUAL(connect_batched(tx), error::op_check_sig_verify3);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_unknown_key_type__success)
+{
+    // Signature validation of an unknown key type is considered successful.
+    const data_chunk key{ 0x42 };
+    const auto tx = tapscript_spender(checksig_leaf(key), true, true);
+    BOOST_REQUIRE_EQUAL(connect(tx), error::script_success);
+    BOOST_REQUIRE_EQUAL(connect_batched(tx), error::script_success);
+}
+
+// The budget is 50 plus the input witness size, and each checksig with a
+// non-empty signature costs 50, so the budget is exceeded at some repeat.
+static void require_budget(const data_chunk& key)
+{
+    for (size_t repeats{}; repeats < 20u; ++repeats)
+    {
+        const auto tx = tapscript_spender(checksig_leaf(key, repeats), true);
+        const auto& witness = tx.inputs_ptr()->front()->witness();
+        const auto cost = add1(repeats) * chain::signature_cost;
+        const auto budget = chain::signature_cost + witness.serialized_size(true);
+        const code expected = cost <= budget ? error::script_success :
+            code{ error::op_check_sig_verify6 };
+        BOOST_REQUIRE_EQUAL(connect(tx), expected);
+        BOOST_REQUIRE_EQUAL(connect_batched(tx), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_budget__expected)
+{
+    require_budget(to_chunk(spend_point()));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__tapscript_check_sig_unknown_key_type_budget__expected)
+{
+    // The budget applies to a non-empty signature of any key type.
+    require_budget({ 0x42 });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(script_cache_tests)
+
+using namespace system::machine;
+
+static const auto salt = base16_hash("0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20");
+static const auto tx_hash = base16_hash("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+
+BOOST_AUTO_TEST_CASE(script_cache__capacity__rounded_to_ways__expected)
+{
+    BOOST_REQUIRE_EQUAL(script_cache(0, salt).capacity(), 4u);
+    BOOST_REQUIRE_EQUAL(script_cache(10, salt).capacity(), 12u);
+    BOOST_REQUIRE_EQUAL(script_cache(1024, salt).capacity(), 1024u);
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__exists__empty__false)
+{
+    const script_cache cache{ 1024, salt };
+    BOOST_REQUIRE(!cache.exists(tx_hash, 0, 0));
+    BOOST_REQUIRE(!cache.exists(null_hash, 0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__exists__stored__true)
+{
+    script_cache cache{ 1024, salt };
+    cache.store(tx_hash, 1, 42);
+    BOOST_REQUIRE(cache.exists(tx_hash, 1, 42));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__exists__different_key_parts__false)
+{
+    script_cache cache{ 1024, salt };
+    cache.store(tx_hash, 1, 42);
+    BOOST_REQUIRE(!cache.exists(null_hash, 1, 42));
+    BOOST_REQUIRE(!cache.exists(tx_hash, 0, 42));
+    BOOST_REQUIRE(!cache.exists(tx_hash, 1, 0));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__exists__different_salt__false)
+{
+    script_cache cache{ 4, salt };
+    script_cache other{ 4, null_hash };
+    cache.store(tx_hash, 1, 42);
+    other.store(tx_hash, 2, 42);
+    BOOST_REQUIRE(cache.exists(tx_hash, 1, 42));
+    BOOST_REQUIRE(!cache.exists(tx_hash, 2, 42));
+}
+
+BOOST_AUTO_TEST_CASE(script_cache__store__beyond_capacity__bounded)
+{
+    script_cache cache{ 4, salt };
+    for (uint32_t index = 0; index < 100; ++index)
+        cache.store(tx_hash, index, 42);
+
+    size_t found{};
+    for (uint32_t index = 0; index < 100; ++index)
+        found += cache.exists(tx_hash, index, 42) ? one : zero;
+
+    BOOST_REQUIRE_EQUAL(found, cache.capacity());
+    BOOST_REQUIRE(cache.exists(tx_hash, 99, 42));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
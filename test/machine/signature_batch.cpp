@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(signature_batch_tests)
+
+using namespace system::machine;
+
+static void defer(signature_batch& batch, uint8_t seed, bool valid,
+    const code& failure)
+{
+    ec_secret secret{};
+    secret.back() = seed;
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    ec_xonly xonly{};
+    std::copy_n(std::next(point.begin()), ec_xonly_size, xonly.begin());
+    const auto hash = sha256_hash(data_chunk{ seed });
+
+    ec_signature signature{};
+    BOOST_REQUIRE(schnorr::sign(signature, secret, hash, null_hash));
+    if (!valid)
+        signature.front() ^= 1u;
+
+    batch.defer(xonly, hash, signature, failure);
+}
+
+// Script path commitment of a leaf at the root (no merkle path).
+static void defer_commitment(signature_batch& batch, uint8_t seed, bool valid,
+    const code& failure)
+{
+    ec_secret secret{};
+    secret.back() = seed;
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    const auto leaf = sha256_hash(data_chunk{ seed });
+    const auto internal = slice<one, ec_compressed_size>(point);
+    point.front() = ec_even_sign;
+    BOOST_REQUIRE(ec_add(point, tagged_hash("TapTweak",
+        splice(internal, leaf))));
+
+    const auto parity = point.front() != ec_even_sign;
+    data_chunk control{ parity ? add1(chain::tapscript_version) :
+        chain::tapscript_version };
+    control.insert(control.end(), internal.begin(), internal.end());
+    chain::taproot::commitment commitment
+    {
+        chain::tapscript{ to_shared(std::move(control)) },
+        slice<one, ec_compressed_size>(point),
+        leaf
+    };
+
+    if (!valid)
+        commitment.out_key.back() ^= 1u;
+
+    batch.defer(std::move(commitment), failure);
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__empty__passthrough)
+{
+    const signature_batch batch{};
+    BOOST_REQUIRE(is_zero(batch.size()));
+    BOOST_REQUIRE_EQUAL(batch.verify(error::script_success), error::script_success);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::stack_false), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__valid__passthrough)
+{
+    signature_batch batch{};
+    defer(batch, 1, true, error::op_check_sig_verify5);
+    defer(batch, 2, true, error::op_check_schnorr_sig6);
+    BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::script_success), error::script_success);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::stack_false), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__invalid__first_failure)
+{
+    signature_batch batch{};
+    defer(batch, 1, true, error::stack_false);
+    defer(batch, 2, false, error::op_check_schnorr_sig6);
+    defer(batch, 3, false, error::op_check_sig_verify5);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::script_success), error::op_check_schnorr_sig6);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::stack_false), error::op_check_schnorr_sig6);
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__valid_commitments__passthrough)
+{
+    signature_batch batch{};
+    defer(batch, 1, true, error::op_check_sig_verify5);
+    defer_commitment(batch, 2, true, error::invalid_commitment);
+    defer_commitment(batch, 3, true, error::invalid_commitment);
+    BOOST_REQUIRE_EQUAL(batch.size(), 3u);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::stack_false), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__invalid_commitment_first__commitment_failure)
+{
+    signature_batch batch{};
+    defer(batch, 1, true, error::op_check_sig_verify5);
+    defer_commitment(batch, 2, false, error::invalid_commitment);
+    defer(batch, 3, false, error::op_check_schnorr_sig6);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::stack_false), error::invalid_commitment);
+}
+
+BOOST_AUTO_TEST_CASE(signature_batch__verify__invalid_signature_first__signature_failure)
+{
+    signature_batch batch{};
+    defer_commitment(batch, 1, true, error::invalid_commitment);
+    defer(batch, 2, false, error::op_check_schnorr_sig6);
+    defer_commitment(batch, 3, false, error::invalid_commitment);
+    BOOST_REQUIRE_EQUAL(batch.verify(error::stack_false), error::op_check_schnorr_sig6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -52,4 +52,122 @@ BOOST_AUTO_TEST_CASE(stack__pop__pushed_chunk__expected)
     BOOST_REQUIRE(stack.pop() == stack_variant{ ptr });
 }
 
+// flat_stack
+
+BOOST_AUTO_TEST_CASE(stack__flat__pop__pushed_chunk__expected)
+{
+    const auto expected = data_chunk{ 0x42, 0x43, 0x44, 0x45, 0x46 };
+    const chunk_xptr ptr{ expected };
+    stack<flat_stack> stack{};
+    stack.push(true);
+    stack.push(42);
+    stack.push(data_chunk{ 0x42, 0x43, 0x44, 0x45, 0x46 });
+    BOOST_REQUIRE_EQUAL(stack.size(), 3u);
+    BOOST_REQUIRE(stack.pop() == stack_variant{ ptr });
+    BOOST_REQUIRE(stack.pop() == stack_variant{ 42 });
+    BOOST_REQUIRE(stack.pop() == stack_variant{ true });
+    BOOST_REQUIRE(stack.empty());
+}
+
+BOOST_AUTO_TEST_CASE(stack__flat__swap_erase__expected)
+{
+    stack<flat_stack> stack{ flat_stack{ stack_variant{ 1 }, stack_variant{ 2 }, stack_variant{ 3 } } };
+    stack.swap(0, 2);
+    BOOST_REQUIRE(stack.peek(0) == stack_variant{ 1 });
+    BOOST_REQUIRE(stack.peek(2) == stack_variant{ 3 });
+    stack.erase(1);
+    BOOST_REQUIRE_EQUAL(stack.size(), 2u);
+    BOOST_REQUIRE(stack.peek(0) == stack_variant{ 1 });
+    BOOST_REQUIRE(stack.peek(1) == stack_variant{ 3 });
+}
+
+BOOST_AUTO_TEST_CASE(stack__flat__copy__shares_tethered_chunks)
+{
+    const auto expected = data_chunk{ 0x42, 0x43 };
+    const chunk_xptr ptr{ expected };
+    std::optional<stack<flat_stack>> original{ std::in_place };
+    original->push(data_chunk{ 0x42, 0x43 });
+    auto copy{ *original };
+    original.reset();
+    BOOST_REQUIRE(copy.pop() == stack_variant{ ptr });
+}
+
+BOOST_AUTO_TEST_CASE(stack__flat__peek_chunk_integer__tethered)
+{
+    stack<flat_stack> stack{};
+    stack.push(42);
+    BOOST_REQUIRE_EQUAL(*stack.peek_chunk(), data_chunk{ 42 });
+}
+
+BOOST_AUTO_TEST_CASE(stack__flat__push_small_chunk__bytes_in_stack_arena)
+{
+    stack<flat_stack> stack{};
+    stack.push(data_chunk(75, 0x42));
+    stack.push(data_chunk(76, 0x42));
+    BOOST_REQUIRE(stack.peek_chunk()->get_allocator().resource() ==
+        default_arena::get());
+
+    stack.drop();
+    BOOST_REQUIRE(stack.peek_chunk()->get_allocator().resource() !=
+        default_arena::get());
+    BOOST_REQUIRE_EQUAL(*stack.peek_chunk(), data_chunk(75, 0x42));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+BOOST_AUTO_TEST_SUITE(stack_performance_tests)
+
+// Approximates a p2wpkh run: project witness, dup/hash160/equalverify/checksig.
+template <typename Container>
+uint64_t run_stack(size_t count) NOEXCEPT
+{
+    const data_chunk signature(72, 0x42);
+    const data_chunk key(33, 0x43);
+    uint64_t total{};
+
+    for (size_t run = 0; run < count; ++run)
+    {
+        stack<Container> instance{ Container
+        {
+            stack_variant{ chunk_xptr{ signature } },
+            stack_variant{ chunk_xptr{ key } }
+        } };
+
+        instance.push(stack_variant{ instance.top() });
+        instance.push(data_chunk(20, narrow_cast<uint8_t>(run)));
+        instance.push(data_chunk(20, narrow_cast<uint8_t>(run)));
+        total += stack<Container>::equal_chunks(instance.pop(), instance.pop()) ? one : zero;
+        instance.drop();
+        instance.drop();
+        instance.emplace_boolean(true);
+        total += instance.size();
+    }
+
+    return total;
+}
+
+template <typename Container>
+void time_stack(const std::string& name, size_t count) NOEXCEPT
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto total = run_stack<Container>(count);
+    const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::cout << name << " : " << time << "ns (" << total << ")" << std::endl;
+    BOOST_REQUIRE_EQUAL(total, count * 3u);
+}
+
+BOOST_AUTO_TEST_CASE(stack__performance__p2wpkh__all_containers)
+{
+    constexpr size_t count = 1'000'000;
+    time_stack<linked_stack>("linked_stack", count);
+    time_stack<contiguous_stack>("contiguous_stack", count);
+    time_stack<flat_stack>("flat_stack", count);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
+
+#endif // HAVE_PERFORMANCE_TESTS
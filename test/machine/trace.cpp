@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(trace_tests)
+
+using namespace system::chain;
+using namespace system::machine;
+
+static input spend(const operations& prevout, const data_stack& stack)
+{
+    input in{ point{}, script{}, witness{ stack }, 0 };
+    in.prevout = to_shared<output>(0, script{ prevout });
+    return in;
+}
+
+// classify
+
+BOOST_AUTO_TEST_CASE(trace__classify__no_prevout__other)
+{
+    BOOST_REQUIRE(op_trace::classify(input{}) == spend_pattern::other);
+}
+
+BOOST_AUTO_TEST_CASE(trace__classify__key_hash__p2pkh)
+{
+    const auto in = spend(script::to_pay_key_hash_pattern(null_short_hash), {});
+    BOOST_REQUIRE(op_trace::classify(in) == spend_pattern::p2pkh);
+}
+
+BOOST_AUTO_TEST_CASE(trace__classify__script_hash__p2sh)
+{
+    const auto in = spend(script::to_pay_script_hash_pattern(null_short_hash), {});
+    BOOST_REQUIRE(op_trace::classify(in) == spend_pattern::p2sh);
+}
+
+BOOST_AUTO_TEST_CASE(trace__classify__witness_key_hash__p2wpkh)
+{
+    const auto in = spend(script::to_pay_witness_key_hash_pattern(null_short_hash), {});
+    BOOST_REQUIRE(op_trace::classify(in) == spend_pattern::p2wpkh);
+}
+
+BOOST_AUTO_TEST_CASE(trace__classify__witness_script_hash__p2wsh)
+{
+    const auto in = spend(script::to_pay_witness_script_hash_pattern(null_hash), {});
+    BOOST_REQUIRE(op_trace::classify(in) == spend_pattern::p2wsh);
+}
+
+BOOST_AUTO_TEST_CASE(trace__classify__taproot_lone_element__p2tr_keypath)
+{
+    const auto in = spend(script::to_pay_witness_taproot_pattern(null_hash),
+        { data_chunk(64, 0x42) });
+    BOOST_REQUIRE(op_trace::classify(in) == spend_pattern::p2tr_keypath);
+}
+
+BOOST_AUTO_TEST_CASE(trace__classify__taproot_multiple_elements__p2tr_scriptpath)
+{
+    const auto in = spend(script::to_pay_witness_taproot_pattern(null_hash),
+        { data_chunk{ 0x51 }, data_chunk(33, 0xc0) });
+    BOOST_REQUIRE(op_trace::classify(in) == spend_pattern::p2tr_scriptpath);
+}
+
+BOOST_AUTO_TEST_CASE(trace__classify__null_data__other)
+{
+    const auto in = spend(script::to_pay_null_data_pattern(data_chunk{ 42 }), {});
+    BOOST_REQUIRE(op_trace::classify(in) == spend_pattern::other);
+}
+
+// record/reset
+
+BOOST_AUTO_TEST_CASE(trace__record__opcode__accumulates_maximum_depth)
+{
+    using namespace std::chrono;
+    op_trace::reset();
+    op_trace::record(opcode::dup, nanoseconds{ 10 }, 3);
+    op_trace::record(opcode::dup, nanoseconds{ 5 }, 1);
+
+    const auto opcodes = op_trace::opcodes();
+    const auto& dup = opcodes.at(static_cast<uint8_t>(opcode::dup));
+    BOOST_REQUIRE_EQUAL(dup.executions, 2u);
+    BOOST_REQUIRE_EQUAL(dup.nanoseconds, 15u);
+    BOOST_REQUIRE_EQUAL(dup.depth, 3u);
+    BOOST_REQUIRE(is_zero(opcodes.at(static_cast<uint8_t>(opcode::drop)).executions));
+
+    op_trace::reset();
+    BOOST_REQUIRE(is_zero(op_trace::opcodes().at(static_cast<uint8_t>(opcode::dup)).executions));
+}
+
+BOOST_AUTO_TEST_CASE(trace__record__pattern__accumulates)
+{
+    using namespace std::chrono;
+    op_trace::reset();
+    op_trace::record(spend_pattern::p2wpkh, nanoseconds{ 7 });
+
+    const auto spends = op_trace::spends();
+    const auto& p2wpkh = spends.at(static_cast<size_t>(spend_pattern::p2wpkh));
+    BOOST_REQUIRE_EQUAL(p2wpkh.executions, 1u);
+    BOOST_REQUIRE_EQUAL(p2wpkh.nanoseconds, 7u);
+    BOOST_REQUIRE(is_zero(spends.at(static_cast<size_t>(spend_pattern::p2sh)).executions));
+    op_trace::reset();
+}
+
+// interpreter
+
+static uint64_t executions(const op_trace::opcode_counters& counters,
+    opcode code) NOEXCEPT
+{
+    return counters.at(static_cast<uint8_t>(code)).executions;
+}
+
+BOOST_AUTO_TEST_CASE(trace__interpreter_connect__script_hash_spend__expected_counters)
+{
+    // Redeem script [1 2 add 3 equal], spent from p2sh.
+    const script redeem{ operations
+    {
+        { opcode::push_positive_1 },
+        { opcode::push_positive_2 },
+        { opcode::add },
+        { opcode::push_positive_3 },
+        { opcode::equal }
+    } };
+
+    const auto serialized = redeem.to_data(false);
+    const transaction tx
+    {
+        1u,
+        inputs{ { point{ null_hash, 0u }, script{ operations{ { serialized, true } } }, 0u } },
+        outputs{ { 0u, script{} } },
+        0u
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared(output
+    {
+        0u, script::to_pay_script_hash_pattern(bitcoin_short_hash(serialized))
+    });
+
+    context state{};
+    state.flags = flags::bip16_rule;
+
+    op_trace::reset();
+    using traced = interpreter<contiguous_stack, op_trace>;
+    BOOST_REQUIRE_EQUAL(traced::connect(state, tx, 0), error::script_success);
+
+    // Input script push, output script hash160 push equal, redeem script.
+    const auto opcodes = op_trace::opcodes();
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::push_size_5), 1u);
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::hash160), 1u);
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::push_size_20), 1u);
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::equal), 2u);
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::push_positive_1), 1u);
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::push_positive_2), 1u);
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::add), 1u);
+    BOOST_REQUIRE_EQUAL(executions(opcodes, opcode::push_positive_3), 1u);
+    BOOST_REQUIRE_EQUAL(opcodes.at(static_cast<uint8_t>(opcode::push_positive_3)).depth, 2u);
+    BOOST_REQUIRE(is_zero(executions(opcodes, opcode::checksig)));
+
+    const auto spends = op_trace::spends();
+    BOOST_REQUIRE_EQUAL(spends.at(static_cast<size_t>(spend_pattern::p2sh)).executions, 1u);
+    BOOST_REQUIRE(is_zero(spends.at(static_cast<size_t>(spend_pattern::other)).executions));
+    op_trace::reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,244 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(fast_reader_tests)
+
+// Failed reads are populated with 0x00 by the reader.
+constexpr uint8_t pad = 0x00;
+
+// construct
+
+BOOST_AUTO_TEST_CASE(fast_reader__construct__default__default_resource)
+{
+    const data_chunk data{};
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.get_arena(), test::get_default_resource());
+    BOOST_REQUIRE_EQUAL(source.get_arena(), source.get_allocator().resource());
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__construct__empty__valid_exhausted)
+{
+    const data_chunk data{};
+    fast_reader source(data);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(source.get_read_position(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__construct__block__matches_byte_reader)
+{
+    const auto genesis = settings(chain::selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    fast_reader source(data, test::get_test_resource<false>());
+    const chain::block block(source, true);
+    BOOST_REQUIRE(block.is_valid());
+    BOOST_REQUIRE(block == genesis);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+// integrals
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_little_endian__integrals__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_2_bytes_little_endian(), 0x0201u);
+    BOOST_REQUIRE_EQUAL(source.read_4_bytes_little_endian(), 0x06050403u);
+    BOOST_REQUIRE_EQUAL((source.read_little_endian<uint16_t, 1>()), 0x07u);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE_EQUAL(source.get_read_position(), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_big_endian__integrals__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_8_bytes_big_endian(), 0x0102030405060708u);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_8_bytes_little_endian__underflow__pad_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_8_bytes_little_endian(), pad);
+    BOOST_REQUIRE(!source);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_variable__all_sizes__expected)
+{
+    const data_chunk data
+    {
+        0x2a,
+        0xfd, 0x01, 0x02,
+        0xfe, 0x01, 0x02, 0x03, 0x04,
+        0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+    };
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_variable(), 0x2au);
+    BOOST_REQUIRE_EQUAL(source.read_variable(), 0x0201u);
+    BOOST_REQUIRE_EQUAL(source.read_variable(), 0x04030201u);
+    BOOST_REQUIRE_EQUAL(source.read_variable(), 0x0807060504030201u);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE(source.is_exhausted());
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_size__exceeds_limit__zero_invalid)
+{
+    const data_chunk data{ 0x2a };
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_size(41), 0u);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__peek_byte__not_empty__not_advanced)
+{
+    const data_chunk data{ 0x2a };
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.peek_byte(), 0x2au);
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0x2au);
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__peek_byte__empty__pad_invalid)
+{
+    const data_chunk data{};
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.peek_byte(), pad);
+    BOOST_REQUIRE(!source);
+}
+
+// bytes
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_hash__full__expected)
+{
+    const auto data = base16_chunk("000102030405060708090a0b0c0d0e0f000102030405060708090a0b0c0d0e0f");
+    fast_reader source(data);
+    BOOST_REQUIRE_EQUAL(source.read_hash(), base16_array("000102030405060708090a0b0c0d0e0f000102030405060708090a0b0c0d0e0f"));
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_bytes_raw__size__expected)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    fast_reader source(data);
+    const auto raw = source.read_bytes_raw(2);
+    BOOST_REQUIRE(!is_null(raw));
+    BOOST_REQUIRE_EQUAL(*raw, (data_chunk{ 0x01, 0x02 }));
+    source.get_allocator().delete_object<data_chunk>(raw);
+    BOOST_REQUIRE_EQUAL(source.read_bytes(), data_chunk{ 0x03 });
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_bytes_raw__underflow__nullptr_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    fast_reader source(data);
+    BOOST_REQUIRE(is_null(source.read_bytes_raw(4)));
+    BOOST_REQUIRE(!source);
+    BOOST_REQUIRE(is_null(source.read_bytes_raw(0)));
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_bytes__underflow__buffer_unchanged_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    fast_reader source(data);
+    data_chunk buffer{ 0x2a, 0x2a, 0x2a, 0x2a };
+    source.read_bytes(buffer.data(), buffer.size());
+    BOOST_REQUIRE_EQUAL(buffer, (data_chunk{ 0x2a, 0x2a, 0x2a, 0x2a }));
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_slice__size__expected_view)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    fast_reader source(data);
+    const auto slice = source.read_slice(2);
+    BOOST_REQUIRE_EQUAL(slice.size(), 2u);
+    BOOST_REQUIRE(slice.data() == data.data());
+    BOOST_REQUIRE_EQUAL(source.get_read_position(), 2u);
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__read_slice__underflow__empty_invalid)
+{
+    const data_chunk data{ 0x01, 0x02, 0x03 };
+    fast_reader source(data);
+    BOOST_REQUIRE(source.read_slice(4).empty());
+    BOOST_REQUIRE(!source);
+}
+
+// control
+
+BOOST_AUTO_TEST_CASE(fast_reader__skip_variable__all_sizes__expected_position)
+{
+    const data_chunk data{ 0xfd, 0x01, 0x02, 0x2a };
+    fast_reader source(data);
+    source.skip_variable();
+    BOOST_REQUIRE_EQUAL(source.get_read_position(), 3u);
+    source.skip_variable();
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE(source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__rewind_bytes__before_start__invalid)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    fast_reader source(data);
+    source.skip_byte();
+    source.rewind_byte();
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE_EQUAL(source.get_read_position(), 0u);
+    source.rewind_bytes(1);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__set_position__after_underflow__cleared)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    fast_reader source(data);
+    source.skip_bytes(3);
+    BOOST_REQUIRE(!source);
+    source.set_position(1);
+    BOOST_REQUIRE(source);
+    BOOST_REQUIRE_EQUAL(source.read_byte(), 0x02u);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__set_position__beyond_end__invalid)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    fast_reader source(data);
+    source.set_position(3);
+    BOOST_REQUIRE(!source);
+}
+
+BOOST_AUTO_TEST_CASE(fast_reader__invalidate__not_empty__exhausted_pad)
+{
+    const data_chunk data{ 0x01, 0x02 };
+    fast_reader source(data);
+    source.invalidate();
+    BOOST_REQUIRE(!source);
+    BOOST_REQUIRE(source.is_exhausted());
+    BOOST_REQUIRE_EQUAL(source.read_byte(), pad);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(fast_writer_tests)
+
+// construct
+
+BOOST_AUTO_TEST_CASE(fast_writer__construct__empty__valid_exhausted)
+{
+    data_chunk data{};
+    fast_writer sink(data);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sink.is_exhausted());
+    BOOST_REQUIRE_EQUAL(sink.get_write_position(), 0u);
+}
+
+// integrals
+
+BOOST_AUTO_TEST_CASE(fast_writer__write_little_endian__integrals__expected)
+{
+    const data_chunk expected{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+    data_chunk data(expected.size());
+    fast_writer sink(data);
+    sink.write_2_bytes_little_endian(0x0201u);
+    sink.write_4_bytes_little_endian(0x06050403u);
+    sink.write_little_endian<uint16_t, 1>(0x07u);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sink.is_exhausted());
+    BOOST_REQUIRE_EQUAL(sink.get_write_position(), 7u);
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(fast_writer__write_big_endian__integrals__expected)
+{
+    const data_chunk expected{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+    data_chunk data(expected.size());
+    fast_writer sink(data);
+    sink.write_8_bytes_big_endian(0x0102030405060708u);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sink.is_exhausted());
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(fast_writer__write_8_bytes_little_endian__overflow__unchanged_invalid)
+{
+    const data_chunk expected{ 0x2a, 0x2a, 0x2a };
+    auto data = expected;
+    fast_writer sink(data);
+    sink.write_8_bytes_little_endian(0x0102030405060708u);
+    BOOST_REQUIRE(!sink);
+    BOOST_REQUIRE(sink.is_exhausted());
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(fast_writer__write_variable__all_sizes__expected)
+{
+    const data_chunk expected
+    {
+        0x2a,
+        0xfd, 0x01, 0x02,
+        0xfe, 0x01, 0x02, 0x03, 0x04,
+        0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+    };
+    data_chunk data(expected.size());
+    fast_writer sink(data);
+    sink.write_variable(0x2au);
+    sink.write_variable(0x0201u);
+    sink.write_variable(0x04030201u);
+    sink.write_variable(0x0807060504030201u);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sink.is_exhausted());
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(fast_writer__write_byte__full__invalid)
+{
+    data_chunk data{ 0x00 };
+    fast_writer sink(data);
+    sink.write_byte(0x2a);
+    BOOST_REQUIRE(sink);
+    sink.write_byte(0x2b);
+    BOOST_REQUIRE(!sink);
+    BOOST_REQUIRE_EQUAL(data, data_chunk{ 0x2a });
+}
+
+// bytes
+
+BOOST_AUTO_TEST_CASE(fast_writer__write_bytes__hash__expected)
+{
+    const auto expected = base16_chunk("000102030405060708090a0b0c0d0e0f000102030405060708090a0b0c0d0e0f");
+    data_chunk data(hash_size);
+    fast_writer sink(data);
+    sink.write_bytes(base16_array("000102030405060708090a0b0c0d0e0f000102030405060708090a0b0c0d0e0f"));
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(fast_writer__skip_bytes__overflow__invalid)
+{
+    data_chunk data(2);
+    fast_writer sink(data);
+    sink.skip_bytes(2);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE_EQUAL(sink.get_write_position(), 2u);
+    sink.skip_bytes(1);
+    BOOST_REQUIRE(!sink);
+}
+
+// chain
+
+BOOST_AUTO_TEST_CASE(fast_writer__write__block__matches_byte_writer)
+{
+    const auto genesis = settings(chain::selection::mainnet).genesis_block;
+    data_chunk expected(genesis.serialized_size(true));
+    stream::out::fast ostream(expected);
+    write::bytes::fast out(ostream);
+    genesis.to_data(out, true);
+
+    data_chunk data(genesis.serialized_size(true));
+    fast_writer sink(data);
+    genesis.to_data(sink, true);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sink.is_exhausted());
+    BOOST_REQUIRE_EQUAL(data, expected);
+}
+
+BOOST_AUTO_TEST_CASE(fast_writer__write__segregated_transaction__round_trips)
+{
+    using namespace chain;
+    const transaction instance
+    {
+        2u,
+        inputs
+        {
+            { point{ one_hash, 0 }, script{ "[0102] drop" }, witness{ "[0102] [030405]" }, 42u }
+        },
+        outputs
+        {
+            { 1000u, script{ "[0506] drop" } }
+        },
+        7u
+    };
+
+    data_chunk data(instance.serialized_size(true));
+    fast_writer sink(data);
+    instance.to_data(sink, true);
+    BOOST_REQUIRE(sink);
+    BOOST_REQUIRE(sink.is_exhausted());
+    BOOST_REQUIRE(transaction(data, true) == instance);
+}
+
+BOOST_AUTO_TEST_SUITE_END()